@@ -0,0 +1,121 @@
+// This is on target example, but it can also run on Keil simulator.
+
+// Example: Measure software critical section enter and leave cost without and with contention.
+//          Number of core cycles is read from DWT cycle counter and results
+//          are printed to ITM trace.
+
+#include <kernel.hpp>
+
+#include <stm32f1xx.h>
+
+namespace
+{
+    constexpr uint32_t number_of_rounds{ 10'000U};
+    constexpr uint32_t number_of_workers{ 2U};
+
+    kernel::critical_section::Context cs_context;
+
+    volatile uint32_t shared_counter{ 0U};
+    volatile uint32_t finished_workers{ 0U};
+    volatile uint32_t contended_start{ 0U};
+
+    void printNumber( uint32_t a_value)
+    {
+        char text[ 11]{};
+        size_t i = sizeof( text) - 1U;
+
+        do
+        {
+            --i;
+            text[ i] = static_cast< char>( '0' + ( a_value % 10U));
+            a_value /= 10U;
+        } while ( ( 0U != a_value) && ( i > 0U));
+
+        kernel::hardware::debug::print( &text[ i]);
+    }
+
+    void startCycleCounter()
+    {
+        CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+        DWT->CYCCNT = 0U;
+        DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+    }
+
+    void enterLeave()
+    {
+        kernel::critical_section::enter( cs_context);
+        shared_counter = shared_counter + 1U;
+        kernel::critical_section::leave( cs_context);
+    }
+}
+
+// Workers share critical section and are preempted by round-robin, sometimes inside of it.
+void worker_task( void * a_parameter)
+{
+    for ( uint32_t round = 0U; round < number_of_rounds; ++round)
+    {
+        enterLeave();
+    }
+
+    kernel::critical_section::enter( cs_context);
+    {
+        ++finished_workers;
+
+        if ( number_of_workers == finished_workers)
+        {
+            const uint32_t cycles = DWT->CYCCNT - contended_start;
+
+            printNumber( number_of_workers);
+            kernel::hardware::debug::print( " tasks: ");
+            printNumber( cycles / ( number_of_workers * number_of_rounds));
+            kernel::hardware::debug::print( " cycles per enter + leave\n");
+            kernel::hardware::debug::print( "done\n");
+        }
+    }
+    kernel::critical_section::leave( cs_context);
+}
+
+void benchmark_task( void * a_parameter)
+{
+    startCycleCounter();
+
+    kernel::hardware::debug::print( "critical_section benchmark\n");
+
+    if ( false == kernel::critical_section::init( cs_context))
+    {
+        kernel::hardware::debug::print( "Failed to create critical section.\n");
+        return;
+    }
+
+    const uint32_t start = DWT->CYCCNT;
+
+    for ( uint32_t round = 0U; round < number_of_rounds; ++round)
+    {
+        enterLeave();
+    }
+
+    const uint32_t cycles = DWT->CYCCNT - start;
+
+    kernel::hardware::debug::print( "1 task: ");
+    printNumber( cycles / number_of_rounds);
+    kernel::hardware::debug::print( " cycles per enter + leave\n");
+
+    contended_start = DWT->CYCCNT;
+
+    for ( uint32_t i = 0U; i < number_of_workers; ++i)
+    {
+        kernel::task::create( worker_task, kernel::task::Priority::Medium);
+    }
+}
+
+int main()
+{
+    kernel::init();
+
+    // Note: Highest priority, so round-robin of other tasks is not measured.
+    kernel::task::create( benchmark_task, kernel::task::Priority::High);
+
+    kernel::start();
+
+    for(;;);
+}
@@ -0,0 +1,167 @@
+// This is on target example, but it can also run on Keil simulator.
+
+// Example: Measure static queue and Typed static queue throughput for different element sizes.
+//          Number of core cycles is read from DWT cycle counter and results
+//          are printed to ITM trace.
+
+#include <kernel.hpp>
+
+#include <stm32f1xx.h>
+
+namespace
+{
+    constexpr size_t queue_length{ 16U};
+    constexpr uint32_t number_of_rounds{ 100U};
+
+    template< size_t Size>
+    struct Element
+    {
+        alignas( Size % 4U == 0U ? 4U : 1U) uint8_t m_data[ Size];
+    };
+
+    void printNumber( uint32_t a_value)
+    {
+        char text[ 11]{};
+        size_t i = sizeof( text) - 1U;
+
+        do
+        {
+            --i;
+            text[ i] = static_cast< char>( '0' + ( a_value % 10U));
+            a_value /= 10U;
+        } while ( ( 0U != a_value) && ( i > 0U));
+
+        kernel::hardware::debug::print( &text[ i]);
+    }
+
+    void startCycleCounter()
+    {
+        CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+        DWT->CYCCNT = 0U;
+        DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+    }
+
+    // Print average number of cycles used by single send and receive pair.
+    template< size_t Size>
+    void measureQueue( kernel::static_queue::Buffer< Element< Size>, queue_length> & a_buffer)
+    {
+        kernel::Handle queue;
+
+        if ( false == kernel::static_queue::create( queue, a_buffer))
+        {
+            kernel::hardware::debug::print( "Failed to create queue.\n");
+            return;
+        }
+
+        Element< Size> input{};
+        Element< Size> output{};
+
+        const uint32_t start = DWT->CYCCNT;
+
+        for ( uint32_t round = 0U; round < number_of_rounds; ++round)
+        {
+            for ( size_t i = 0U; i < queue_length; ++i)
+            {
+                ( void) kernel::static_queue::send( queue, input);
+            }
+
+            for ( size_t i = 0U; i < queue_length; ++i)
+            {
+                ( void) kernel::static_queue::receive( queue, output);
+            }
+        }
+
+        const uint32_t cycles = DWT->CYCCNT - start;
+
+        kernel::static_queue::destroy( queue);
+
+        printNumber( Size);
+        kernel::hardware::debug::print( " B: ");
+        printNumber( cycles / ( number_of_rounds * queue_length));
+        kernel::hardware::debug::print( " cycles per send + receive\n");
+    }
+
+    // Print average number of cycles used by single typed send and receive pair.
+    template< size_t Size>
+    void measureTypedQueue( kernel::static_queue::Typed< Element< Size>, queue_length> & a_queue)
+    {
+        if ( false == kernel::static_queue::create( a_queue))
+        {
+            kernel::hardware::debug::print( "Failed to create typed queue.\n");
+            return;
+        }
+
+        Element< Size> input{};
+        Element< Size> output{};
+
+        const uint32_t start = DWT->CYCCNT;
+
+        for ( uint32_t round = 0U; round < number_of_rounds; ++round)
+        {
+            for ( size_t i = 0U; i < queue_length; ++i)
+            {
+                ( void) kernel::static_queue::send( a_queue, input);
+            }
+
+            for ( size_t i = 0U; i < queue_length; ++i)
+            {
+                ( void) kernel::static_queue::receive( a_queue, output);
+            }
+        }
+
+        const uint32_t cycles = DWT->CYCCNT - start;
+
+        kernel::static_queue::destroy( a_queue);
+
+        printNumber( Size);
+        kernel::hardware::debug::print( " B: ");
+        printNumber( cycles / ( number_of_rounds * queue_length));
+        kernel::hardware::debug::print( " cycles per typed send + receive\n");
+    }
+
+    // Note: Buffers are too big to be placed on task stack.
+    kernel::static_queue::Buffer< Element< 1U>, queue_length>  buffer_1;
+    kernel::static_queue::Buffer< Element< 4U>, queue_length>  buffer_4;
+    kernel::static_queue::Buffer< Element< 8U>, queue_length>  buffer_8;
+    kernel::static_queue::Buffer< Element< 16U>, queue_length> buffer_16;
+    kernel::static_queue::Buffer< Element< 32U>, queue_length> buffer_32;
+
+    kernel::static_queue::Typed< Element< 1U>, queue_length>  typed_queue_1;
+    kernel::static_queue::Typed< Element< 4U>, queue_length>  typed_queue_4;
+    kernel::static_queue::Typed< Element< 8U>, queue_length>  typed_queue_8;
+    kernel::static_queue::Typed< Element< 16U>, queue_length> typed_queue_16;
+    kernel::static_queue::Typed< Element< 32U>, queue_length> typed_queue_32;
+}
+
+void benchmark_task( void * a_parameter)
+{
+    startCycleCounter();
+
+    kernel::hardware::debug::print( "static_queue benchmark\n");
+
+    measureQueue( buffer_1);
+    measureQueue( buffer_4);
+    measureQueue( buffer_8);
+    measureQueue( buffer_16);
+    measureQueue( buffer_32);
+
+    measureTypedQueue( typed_queue_1);
+    measureTypedQueue( typed_queue_4);
+    measureTypedQueue( typed_queue_8);
+    measureTypedQueue( typed_queue_16);
+    measureTypedQueue( typed_queue_32);
+
+    kernel::hardware::debug::print( "done\n");
+}
+
+int main()
+{
+    kernel::init();
+
+    // Note: Highest priority, so round-robin of other tasks is not measured.
+    kernel::task::create( benchmark_task, kernel::task::Priority::High);
+
+    kernel::start();
+
+    for(;;);
+}
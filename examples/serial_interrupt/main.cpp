@@ -8,34 +8,48 @@
 
 #include "gpio.hpp"
 
-template< size_t StringSize>
-void print( kernel::Handle & a_queue, const char ( &a_string)[ StringSize])
+namespace
 {
-    size_t i = 0U;
+    // Time worker task waits for first received byte, before checking again.
+    constexpr kernel::TimeMs rx_timeout_ms{ 1000U};
 
-    // Skip end-of-string sign.
-    while ( '\0' != a_string[ i] && i < StringSize)
+    // Stream buffer has no name, so interrupt uses its handle directly.
+    kernel::Handle usart_tx_stream{};
+
+    // Name hash is computed at compile time.
+    constexpr kernel::Name rx_queue_name{ "RX queue"};
+
+    // Bound to RX queue name, so it is written by kernel when queue is created.
+    // Interrupt and worker task use it directly, without looking up the name.
+    kernel::Handle usart_rx_queue{};
+}
+
+// Send whole string with as few calls as possible. Stream buffer copies any number of bytes.
+void print( const char * ap_string, size_t a_length)
+{
+    while ( a_length > 0U)
     {
-        uint8_t byte_to_send = static_cast< uint8_t>( a_string[ i]);
+        const size_t bytes_sent = kernel::stream_buffer::send( usart_tx_stream, ap_string, a_length);
 
-        bool byte_sent = kernel::static_queue::send( a_queue, byte_to_send);
+        ap_string += bytes_sent;
+        a_length -= bytes_sent;
 
-        // Stay in the loop until all is sent.
-        if ( false == byte_sent)
-        {
-            kernel::hardware::debug::print( "Tx queue full.\n");
+        // Enable Tx interrupt to flush stream buffer.
+        USART1->CR1 |= USART_CR1_TXEIE;
 
-            // Enable Tx interrupt to free queue.
-            USART1->CR1 |= USART_CR1_TXEIE;
-        }
-        else
+        if ( a_length > 0U)
         {
-            ++i;
+            // Block until Tx interrupt frees some space.
+            kernel::stream_buffer::waitForNotFull( usart_tx_stream);
         }
     }
+}
 
-    // Enable Usart Tx interrupt.
-    USART1->CR1 |= USART_CR1_TXEIE;
+template< size_t StringSize>
+void print( const char ( &a_string)[ StringSize])
+{
+    // Skip end-of-string sign.
+    print( a_string, StringSize - 1U);
 }
 
 extern "C"
@@ -43,13 +57,6 @@ extern "C"
     // Note: Overrun and other errors are not handled.
     void USART1_IRQHandler()
     {
-        kernel::Handle usart_rx_queue{};
-        kernel::Handle usart_tx_queue{};
-
-        // Ignore error checking.
-        ( void) kernel::static_queue::open( usart_rx_queue, "RX queue");
-        ( void) kernel::static_queue::open( usart_tx_queue, "TX queue");
-
         volatile uint16_t status_register = USART1->SR;
 
         // Receive handler.
@@ -72,13 +79,14 @@ extern "C"
         {
             uint8_t char_to_send{};
 
-            // Flush Tx queue.
+            // Flush Tx stream buffer.
             while ( true)
             {
-                bool byte_received = kernel::static_queue::receive(
-                        usart_tx_queue,
-                        char_to_send
-                    );
+                bool byte_received = ( 1U == kernel::stream_buffer::receive(
+                        usart_tx_stream,
+                        &char_to_send,
+                        1U
+                    ));
 
                 if ( true == byte_received)
                 {
@@ -148,54 +156,32 @@ void startup_task( void * a_parameter)
 
 void worker_task( void * a_parameter)
 {
-    constexpr size_t response_buffer_size = 64U;
-    char response_buffer[ response_buffer_size];
-    
-    kernel::Handle usart_rx_queue{};
-    kernel::Handle usart_tx_queue{};
-    
-    // Ignore error checking.
-    ( void) kernel::static_queue::open( usart_rx_queue, "RX queue");
-    ( void) kernel::static_queue::open( usart_tx_queue, "TX queue");
-
-    print( usart_tx_queue, "Worker task started.\n");
+    print( "Worker task started.\n");
 
     while( true)
     {
-        // Wait until at least one element is available in queue.
-        auto result = kernel::sync::waitForSingleObject( usart_rx_queue);
+        // Received bytes are echoed in small chunks, no end-of-string sign is needed.
+        constexpr size_t chunk_size = 16U;
+        char chunk[ chunk_size];
 
-        if ( kernel::sync::WaitResult::ObjectSet == result)
-        {
-            int response_buffer_index = 0;
-            uint8_t received_byte;
+        // Block until at least one element is available in queue.
+        bool byte_received = kernel::static_queue::receive( usart_rx_queue, chunk[ 0U], false, rx_timeout_ms);
 
-            // Flush all queue content until its empty.
-            while ( true)
+        if ( true == byte_received)
+        {
+            // Flush rest of queue content with single call.
+            const size_t chunk_length = 1U + kernel::static_queue::receiveN(
+                usart_rx_queue,
+                reinterpret_cast< uint8_t *>( &chunk[ 1U]),
+                chunk_size - 1U
+            );
+
+            for ( size_t i = 0U; i < chunk_length; ++i)
             {
-                bool queue_not_empty = kernel::static_queue::receive(
-                        usart_rx_queue,
-                        received_byte
-                    );
+                kernel::hardware::debug::putChar( chunk[ i]);
+            }
 
-                if ( true == queue_not_empty)
-                {
-                    kernel::hardware::debug::putChar( static_cast< char>( received_byte));
-                    response_buffer[ response_buffer_index] = received_byte;
-                }
-                else
-                {
-                    // Queue is empty.
-                    response_buffer[ response_buffer_index] = '\0';
-                    print( usart_tx_queue, response_buffer);
-                    break;
-                }
-                ++response_buffer_index;
-            };
-        }
-        else
-        {
-            kernel::hardware::debug::print( "\nWaitForSingleObject error.\n");
+            print( chunk, chunk_length);
         }
     }
 }
@@ -205,18 +191,20 @@ int main()
     constexpr size_t max_queue_elements{ 64U};
 
     kernel::static_queue::Buffer< uint8_t, max_queue_elements> usart_rx_buffer;
-    kernel::static_queue::Buffer< uint8_t, max_queue_elements> usart_tx_buffer;
+    kernel::stream_buffer::Buffer< max_queue_elements> usart_tx_buffer;
     
     kernel::Handle rx_queue{};
-    kernel::Handle tx_queue{};
 
     kernel::init();
 
-    // Create receive and transmit queues with static buffers.
+    // Bind interrupt handle before queue is created. Ignore error checking.
+    ( void) kernel::bind( usart_rx_queue, rx_queue_name);
+
+    // Create receive queue with static buffer.
     bool queue_created = kernel::static_queue::create(
         rx_queue,
         usart_rx_buffer,
-        "RX queue"
+        rx_queue_name
     );
 
     if ( false == queue_created)
@@ -225,15 +213,15 @@ int main()
         kernel::hardware::debug::setBreakpoint();
     }
 
-    queue_created = kernel::static_queue::create(
-        tx_queue,
-        usart_tx_buffer,
-        "TX queue"
+    // Create transmit stream buffer with static buffer.
+    bool stream_created = kernel::stream_buffer::create(
+        usart_tx_stream,
+        usart_tx_buffer
     );
 
-    if ( false == queue_created)
+    if ( false == stream_created)
     {
-        kernel::hardware::debug::print( "\nFailed to create TX queue.\n");
+        kernel::hardware::debug::print( "\nFailed to create TX stream buffer.\n");
         kernel::hardware::debug::setBreakpoint();
     }
     
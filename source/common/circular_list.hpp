@@ -26,7 +26,7 @@ namespace kernel::internal::common
             typedef typename common::MemoryBuffer< Node, MaxSize>::Id MemoryBufferIndex;
 
         public:
-            bool add( TDataType a_new_data, Id & a_new_node_index) volatile
+            bool add( TDataType a_new_data, Id & a_new_node_index)
             {
                 MemoryBufferIndex new_node_index;
 
@@ -37,7 +37,7 @@ namespace kernel::internal::common
 
                 a_new_node_index = static_cast< Id>( new_node_index);
                 
-                volatile Node & new_node = m_buffer.at( new_node_index);
+                Node & new_node = m_buffer.at( new_node_index);
                 
                 switch( m_count)
                 {
@@ -51,7 +51,7 @@ namespace kernel::internal::common
                         break;
                     case 1U: // New Node points to first Node.
                         {
-                            volatile Node & first_node = m_buffer.at( static_cast< MemoryBufferIndex>( m_first));
+                            Node & first_node = m_buffer.at( static_cast< MemoryBufferIndex>( m_first));
                         
                             first_node.m_next = static_cast< uint32_t>( new_node_index);
                             first_node.m_prev = static_cast< uint32_t>( new_node_index);
@@ -61,8 +61,8 @@ namespace kernel::internal::common
                         break;
                     default: // New Node at last position.
                         {
-                            volatile Node & first_node = m_buffer.at( static_cast< MemoryBufferIndex>( m_first));
-                            volatile Node & last_node = m_buffer.at( static_cast< MemoryBufferIndex>( m_last));
+                            Node & first_node = m_buffer.at( static_cast< MemoryBufferIndex>( m_first));
+                            Node & last_node = m_buffer.at( static_cast< MemoryBufferIndex>( m_last));
                         
                             last_node.m_next = static_cast< uint32_t>( new_node_index);
                             first_node.m_prev = static_cast< uint32_t>( new_node_index);
@@ -79,7 +79,7 @@ namespace kernel::internal::common
                 return true;
             }
 
-            void remove( Id a_node_index) volatile
+            void remove( Id a_node_index)
             {
                 if ( m_count > 0U)
                 {
@@ -106,7 +106,7 @@ namespace kernel::internal::common
                 }
             }
 
-            bool find( TDataType & a_key, Id & a_found_index) volatile
+            bool find( TDataType & a_key, Id & a_found_index)
             {
                 uint32_t node_index = m_first;
 
@@ -126,22 +126,22 @@ namespace kernel::internal::common
                 return false;
             }
 
-            volatile TDataType & at( volatile Id a_node_index) volatile
+            TDataType & at( Id a_node_index)
             {
                 return m_buffer.at( static_cast< MemoryBufferIndex>( a_node_index)).m_data;
             }
 
-            Id firstIndex() volatile
+            Id firstIndex()
             {
                 return static_cast< Id>( m_first);
             }
 
-            Id nextIndex( Id a_node_index) volatile
+            Id nextIndex( Id a_node_index)
             {
                 return static_cast< Id>( m_buffer.at( static_cast< MemoryBufferIndex>( a_node_index)).m_next);
             }
             
-            uint32_t count() volatile
+            uint32_t count()
             {
                 return m_count;
             }
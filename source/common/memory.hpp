@@ -1,13 +1,98 @@
 #pragma once
 
+#include <cstddef>
 #include <cstdint>
 #include <cassert>
 #include <type_traits>
 
 // Note: I just didn't want to include whole <cstring>.  Also references are so much nicer.
-// TODO: Simplify, because code size is too big.
 namespace kernel::internal::memory
 {
+    // Word size used by fast copy paths. Cortex-m3 can load and store it in single instruction.
+    constexpr size_t word_size{ sizeof( uint32_t)};
+
+    // Word used to access memory of any type. Copied memory is ie. uint8_t buffer or user
+    // structure, so plain uint32_t access would break strict aliasing rule and could be
+    // miscompiled with optimizations. Attribute is given to a structure, not to a typedef,
+    // since typedef attributes are dropped when type is used as template argument.
+    // Note: MSVC (unit tests) does not use type based alias analysis.
+    #ifdef __GNUC__
+        struct __attribute__(( __may_alias__)) AliasedWord
+    #else
+        struct AliasedWord
+    #endif
+    {
+        uint32_t m_value;
+    };
+
+    static_assert( sizeof( AliasedWord) == word_size);
+
+    // Number of words moved in single iteration of block copy. Words are loaded to registers
+    // first and stored after. On non-volatile path compiler can merge them into LDM/STM pair,
+    // volatile words are always loaded and stored one by one.
+    constexpr size_t block_size_in_words{ 4U};
+
+    // Return 'true' if both addresses and number of bytes allow word-wide copy.
+    inline bool isWordCopyPossible(
+        const volatile void *   ap_destination,
+        const volatile void *   ap_source,
+        size_t                  a_number_of_bytes
+    )
+    {
+        const uintptr_t alignment_bits =
+            reinterpret_cast< uintptr_t>( ap_destination) |
+            reinterpret_cast< uintptr_t>( ap_source) |
+            a_number_of_bytes;
+
+        return ( 0U == ( alignment_bits & ( word_size - 1U)));
+    }
+
+    // Generic fallback. TByte is uint8_t with or without volatile qualifier.
+    template< typename TByte>
+    inline void copyBytes(
+        TByte *         ap_destination,
+        const TByte *   ap_source,
+        size_t          a_number_of_bytes
+    )
+    {
+        for ( size_t i = 0U; i < a_number_of_bytes; ++i)
+        {
+            ap_destination[ i] = ap_source[ i];
+        }
+    }
+
+    // Both pointers must be word aligned. TWord is AliasedWord with or without volatile qualifier.
+    template< typename TWord>
+    inline void copyWords(
+        TWord *         ap_destination,
+        const TWord *   ap_source,
+        size_t          a_number_of_words
+    )
+    {
+        while ( a_number_of_words >= block_size_in_words)
+        {
+            const uint32_t word0 = ap_source[ 0U].m_value;
+            const uint32_t word1 = ap_source[ 1U].m_value;
+            const uint32_t word2 = ap_source[ 2U].m_value;
+            const uint32_t word3 = ap_source[ 3U].m_value;
+
+            ap_destination[ 0U].m_value = word0;
+            ap_destination[ 1U].m_value = word1;
+            ap_destination[ 2U].m_value = word2;
+            ap_destination[ 3U].m_value = word3;
+
+            ap_destination += block_size_in_words;
+            ap_source += block_size_in_words;
+            a_number_of_words -= block_size_in_words;
+        }
+
+        for ( size_t i = 0U; i < a_number_of_words; ++i)
+        {
+            ap_destination[ i].m_value = ap_source[ i].m_value;
+        }
+    }
+
+    // Copy path is selected in run-time, depending on alignment of provided memory.
     template<
         typename TTypeLeft,
         typename TTypeRight
@@ -20,25 +105,26 @@ namespace kernel::internal::memory
     {
         assert( a_number_of_bytes > 0U);
 
-        if constexpr( std::is_volatile< TTypeLeft>::value && std::is_volatile< TTypeRight>::value)
-        {
-            volatile uint8_t * destination = reinterpret_cast< volatile uint8_t*>( &a_destination);
-            const volatile uint8_t * source = reinterpret_cast< const volatile uint8_t*>( &a_source);
+        constexpr bool is_volatile{ std::is_volatile< TTypeLeft>::value && std::is_volatile< TTypeRight>::value};
 
-            for ( size_t i = 0U; i < a_number_of_bytes; ++i)
-            {
-                destination[ i] = source[ i];
-            }
+        typedef std::conditional_t< is_volatile, volatile uint8_t, uint8_t> Byte;
+        typedef std::conditional_t< is_volatile, volatile AliasedWord, AliasedWord> Word;
+
+        if ( isWordCopyPossible( &a_destination, &a_source, a_number_of_bytes))
+        {
+            copyWords(
+                reinterpret_cast< Word *>( &a_destination),
+                reinterpret_cast< const Word *>( &a_source),
+                a_number_of_bytes / word_size
+            );
         }
         else
         {
-            uint8_t * destination = reinterpret_cast< uint8_t*>( &a_destination);
-            const uint8_t * source = reinterpret_cast< const uint8_t*>( &a_source);
-
-            for ( size_t i = 0U; i < a_number_of_bytes; ++i)
-            {
-                destination[ i] = source[ i];
-            }
+            copyBytes(
+                reinterpret_cast< Byte *>( &a_destination),
+                reinterpret_cast< const Byte *>( &a_source),
+                a_number_of_bytes
+            );
         }
     }
 
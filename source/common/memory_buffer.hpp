@@ -18,7 +18,7 @@ namespace kernel::internal::common
         // Note: m_data is not initialized by design.
         MemoryBuffer() : m_status{} {}
             
-        inline bool allocate( Id & a_item_id) volatile
+        inline bool allocate( Id & a_item_id)
         {
             // Find first not used slot and return index as ID.
             for ( uint32_t i = 0U; i < MaxSize; ++i)
@@ -34,7 +34,7 @@ namespace kernel::internal::common
             return false;
         }
 
-        inline void free( Id a_item_id) volatile
+        inline void free( Id a_item_id)
         {
             auto index = static_cast< uint32_t>( a_item_id);
 
@@ -43,7 +43,7 @@ namespace kernel::internal::common
             m_status[ index] = false;
         }
 
-        inline void freeAll() volatile
+        inline void freeAll()
         {
             for ( uint32_t i = 0U; i < MaxSize; ++i)
             {
@@ -51,7 +51,7 @@ namespace kernel::internal::common
             }
         }
 
-        inline volatile TDataType & at( Id a_item_id) volatile
+        inline TDataType & at( Id a_item_id)
         {
             auto index = static_cast< uint32_t>( a_item_id);
 
@@ -61,7 +61,7 @@ namespace kernel::internal::common
             return m_data[ index];
         }
 
-        inline bool isAllocated( Id a_item_id) volatile
+        inline bool isAllocated( Id a_item_id)
         {
             auto index = static_cast< uint32_t>( a_item_id);
 
@@ -78,4 +78,41 @@ namespace kernel::internal::common
         bool        m_status[ MaxSize];
 
     };
+
+    // Empty memory buffer used when kernel object type is disabled in config.hpp.
+    // It takes no memory and nothing can be allocated from it, so all loops over
+    // its items are removed by compiler.
+    template < typename TDataType>
+    class MemoryBuffer< TDataType, 0U>
+    {
+    public:
+        enum class Id : uint32_t{};
+
+        inline bool allocate( Id & /* a_item_id */)
+        {
+            return false;
+        }
+
+        inline void free( Id /* a_item_id */)
+        {
+            assert( false);
+        }
+
+        inline void freeAll()
+        {
+        }
+
+        // Since allocate always fail, there is no valid Id to call this with.
+        inline TDataType & at( Id /* a_item_id */)
+        {
+            assert( false);
+
+            return *static_cast< TDataType *>( nullptr);
+        }
+
+        inline bool isAllocated( Id /* a_item_id */)
+        {
+            return false;
+        }
+    };
 }
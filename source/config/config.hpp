@@ -6,30 +6,152 @@
 // options can be changed depending of specific project
 // goal.
 
+// Project specific configuration should not be done by editing this file.
+// Every option below can be overridden at compile time:
+// - by defining KERNEL_CONFIG_FILE as a path to user header, which defines
+//   any subset of KERNEL_* macros below (ie. -DKERNEL_CONFIG_FILE="my_config.hpp"),
+// - by defining KERNEL_* macros directly from build system. CMake project
+//   expose them as cache options (see CMakeLists.txt).
+// Options that are not overridden use default values defined here.
+
+// Maximum number of optional object type (event groups, semaphores, reader-writer locks,
+// timers, static queues, ring buffers, MPSC queues, priority queues, stream buffers and
+// queue sets) can be set to 0. Its storage is then empty MemoryBuffer, which takes no memory
+// and never allocates, so create of such object fails and loops over its items are removed
+// by compiler. Its API is still compiled, but it is not linked if it is not used.
+// Object types added after timers and static queues are disabled by default, so project pays
+// only for what it enables. The same holds for name registry: without it, named events and
+// queues are opened by scanning them for the name pointer and kernel::bind fails.
+// Tasks and events cannot be disabled: kernel itself creates Idle task and uses events for
+// software critical sections.
+#if defined( KERNEL_CONFIG_FILE)
+    #include KERNEL_CONFIG_FILE
+#endif
+
+#ifndef KERNEL_CORE_CLOCK_FREQ_HZ
+    #define KERNEL_CORE_CLOCK_FREQ_HZ 72000000U
+#endif
+
+#ifndef KERNEL_TASK_STACK_SIZE
+    #define KERNEL_TASK_STACK_SIZE 256U
+#endif
+
+// Includes Idle task and timer service task, if timer callbacks are enabled.
+#ifndef KERNEL_TASK_MAX_NUMBER
+    #define KERNEL_TASK_MAX_NUMBER 10U
+#endif
+
+#ifndef KERNEL_CONTEXT_SWITCH_INTERVAL_MS
+    #define KERNEL_CONTEXT_SWITCH_INTERVAL_MS 10U
+#endif
+
+#ifndef KERNEL_EVENT_MAX_NUMBER
+    #define KERNEL_EVENT_MAX_NUMBER 8U
+#endif
+
+#ifndef KERNEL_EVENT_GROUP_MAX_NUMBER
+    #define KERNEL_EVENT_GROUP_MAX_NUMBER 0U
+#endif
+
+#ifndef KERNEL_SEMAPHORE_MAX_NUMBER
+    #define KERNEL_SEMAPHORE_MAX_NUMBER 0U
+#endif
+
+#ifndef KERNEL_RW_LOCK_MAX_NUMBER
+    #define KERNEL_RW_LOCK_MAX_NUMBER 0U
+#endif
+
+#ifndef KERNEL_TIMER_MAX_NUMBER
+    #define KERNEL_TIMER_MAX_NUMBER 8U
+#endif
+
+// Timer service task, which calls timer callbacks, takes one task slot, so it is opt-in.
+#ifndef KERNEL_TIMER_CALLBACK_ENABLE
+    #define KERNEL_TIMER_CALLBACK_ENABLE 0
+#endif
+
+// 0 - High, 1 - Medium, 2 - Low.
+#ifndef KERNEL_TIMER_TASK_PRIORITY
+    #define KERNEL_TIMER_TASK_PRIORITY 0U
+#endif
+
+#ifndef KERNEL_QUEUE_MAX_NUMBER
+    #define KERNEL_QUEUE_MAX_NUMBER 4U
+#endif
+
+#ifndef KERNEL_QUEUE_STATS_ENABLE
+    #define KERNEL_QUEUE_STATS_ENABLE 0
+#endif
+
+#ifndef KERNEL_RING_BUFFER_MAX_NUMBER
+    #define KERNEL_RING_BUFFER_MAX_NUMBER 0U
+#endif
+
+#ifndef KERNEL_MPSC_QUEUE_MAX_NUMBER
+    #define KERNEL_MPSC_QUEUE_MAX_NUMBER 0U
+#endif
+
+#ifndef KERNEL_PRIORITY_QUEUE_MAX_NUMBER
+    #define KERNEL_PRIORITY_QUEUE_MAX_NUMBER 0U
+#endif
+
+#ifndef KERNEL_STREAM_BUFFER_MAX_NUMBER
+    #define KERNEL_STREAM_BUFFER_MAX_NUMBER 0U
+#endif
+
+#ifndef KERNEL_QUEUE_SET_MAX_NUMBER
+    #define KERNEL_QUEUE_SET_MAX_NUMBER 0U
+#endif
+
+#ifndef KERNEL_NAME_REGISTRY_SIZE
+    #define KERNEL_NAME_REGISTRY_SIZE 0U
+#endif
+
+#ifndef KERNEL_WAIT_MAX_INPUT_SIGNALS
+    #define KERNEL_WAIT_MAX_INPUT_SIGNALS 8U
+#endif
+
+#ifndef KERNEL_DEBUG_MESSAGES_ENABLE
+    #define KERNEL_DEBUG_MESSAGES_ENABLE 1
+#endif
+
 namespace kernel::internal::hardware
 {
     // Core clock frequency used to drive SysTick (kernel timer).
-    constexpr uint32_t core_clock_freq_hz{ 72'000'000U};
+    constexpr uint32_t core_clock_freq_hz{ KERNEL_CORE_CLOCK_FREQ_HZ};
 
     namespace task
     {
         // Define maximum stack size for each task.
         // Setting this too low or decreasing compiler optimization levels
         // can easly cause undefined behaviour due to stack over/under-flow.
-        constexpr uint32_t stack_size{ 256U};
+        constexpr uint32_t stack_size{ KERNEL_TASK_STACK_SIZE};
+
+        // Initial stack frame alone takes 8 words.
+        static_assert( stack_size > 8U, "Task stack size is too small!");
     }
 }
 
 namespace kernel::internal::task
 {
-    // Define maximum number of tasks.
-    constexpr uint32_t max_number{ 10U};
+    // Define maximum number of tasks. Idle task and timer service task (if timer callbacks
+    // are enabled) take one slot each.
+    constexpr uint32_t max_number{ KERNEL_TASK_MAX_NUMBER};
+
+    // Idle task is always created by kernel::init.
+    static_assert( max_number > 0U, "At least one task (Idle) is required!");
+
+    // Define priority of internal critical section.
+    // It should be equal or higher than interrupts notifying tasks.
+    constexpr auto critical_section_priority{
+        kernel::hardware::interrupt::priority::Preemption::Kernel
+    };
 }
 
 namespace kernel::internal::system_timer
 {
     // Round-robin context switch intervals in miliseconds.
-    constexpr TimeMs context_switch_interval_ms{ 10U};
+    constexpr TimeMs context_switch_interval_ms{ KERNEL_CONTEXT_SWITCH_INTERVAL_MS};
 }
 
 namespace kernel::internal::event
@@ -38,7 +160,7 @@ namespace kernel::internal::event
     // It must be noted that kernel itself can implicitly
     // create and delete events for internal use and setting
     // this value to 0 will brick some kernel functionality.
-    constexpr uint32_t max_number{ 8U};
+    constexpr uint32_t max_number{ KERNEL_EVENT_MAX_NUMBER};
 
     // Define priority of internal critical section.
     // It should be equal or higher than interrupts using event API.
@@ -48,10 +170,59 @@ namespace kernel::internal::event
     };
 }
 
+namespace kernel::internal::event_group
+{
+    // Define maximum number of event groups.
+    // Setting this value to 0 remove event groups from kernel.
+    constexpr size_t max_number{ KERNEL_EVENT_GROUP_MAX_NUMBER};
+
+    // Define priority of internal critical section.
+    // It should be equal or higher than interrupt setting or clearing event group flags.
+    constexpr auto critical_section_priority{
+        kernel::hardware::interrupt::priority::Preemption::Kernel
+    };
+}
+
+namespace kernel::internal::semaphore
+{
+    // Define maximum number of counting semaphores.
+    // Setting this value to 0 remove semaphores from kernel.
+    constexpr size_t max_number{ KERNEL_SEMAPHORE_MAX_NUMBER};
+
+    // Define priority of internal critical section.
+    // It should be equal or higher than interrupt giving or taking semaphores.
+    constexpr auto critical_section_priority{
+        kernel::hardware::interrupt::priority::Preemption::Kernel
+    };
+}
+
+namespace kernel::internal::rw_lock
+{
+    // Define maximum number of reader-writer locks.
+    // Setting this value to 0 remove reader-writer locks from kernel.
+    constexpr size_t max_number{ KERNEL_RW_LOCK_MAX_NUMBER};
+
+    // Define priority of internal critical section.
+    // It should be equal or higher than interrupt trying or releasing read lock.
+    constexpr auto critical_section_priority{
+        kernel::hardware::interrupt::priority::Preemption::Kernel
+    };
+}
+
 namespace kernel::internal::timer
 {
     // Define maximum number of software timers.
-    constexpr uint32_t max_number{ 8U};
+    // Setting this value to 0 remove software timers from kernel.
+    constexpr uint32_t max_number{ KERNEL_TIMER_MAX_NUMBER};
+
+    // Enable timers with callback. Timer service task, which calls them, is created by
+    // kernel::init, so it is either available to all timers or to none.
+    constexpr bool callback_enable{ ( max_number > 0U) && ( 0 != KERNEL_TIMER_CALLBACK_ENABLE)};
+
+    // Define priority of timer service task, which calls timer callbacks.
+    constexpr auto task_priority{ static_cast< kernel::task::Priority>( KERNEL_TIMER_TASK_PRIORITY)};
+
+    static_assert( task_priority < kernel::task::Priority::Idle, "Timer service task cannot have Idle priority!");
 
     // Define priority of internal critical section.
     // It should be equal or higher than interrupts using software timers API.
@@ -65,7 +236,12 @@ namespace kernel::internal::timer
 namespace kernel::internal::queue
 {
     // Define maximum number of static queues.
-    constexpr size_t max_number{ 4U};
+    // Setting this value to 0 remove static queues from kernel.
+    constexpr size_t max_number{ KERNEL_QUEUE_MAX_NUMBER};
+
+    // Enable per queue statistics (kernel::static_queue::getStats). Counters are updated on
+    // every send and receive and full queues are checked on every system tick.
+    constexpr bool stats_enable{ 0 != KERNEL_QUEUE_STATS_ENABLE};
 
     // Define priority of internal critical section.
     // It should be equal or higher than interrupt using queue API.
@@ -76,15 +252,88 @@ namespace kernel::internal::queue
     };
 }
 
+namespace kernel::internal::ring_buffer
+{
+    // Define maximum number of lock-free ring buffers.
+    // Setting this value to 0 remove ring buffers from kernel.
+    // Note: Ring buffer does not use critical section, so there is no priority to set.
+    constexpr size_t max_number{ KERNEL_RING_BUFFER_MAX_NUMBER};
+}
+
+namespace kernel::internal::mpsc_queue
+{
+    // Define maximum number of lock-free multiple producers, single consumer queues.
+    // Setting this value to 0 remove MPSC queues from kernel.
+    // Note: MPSC queue does not use critical section, so there is no priority to set.
+    constexpr size_t max_number{ KERNEL_MPSC_QUEUE_MAX_NUMBER};
+}
+
+namespace kernel::internal::priority_queue
+{
+    // Define maximum number of priority message queues.
+    // Setting this value to 0 remove priority queues from kernel.
+    constexpr size_t max_number{ KERNEL_PRIORITY_QUEUE_MAX_NUMBER};
+
+    // Define priority of internal critical section.
+    // It should be equal or higher than interrupt using priority queue API.
+    constexpr auto critical_section_priority{
+        kernel::hardware::interrupt::priority::Preemption::Kernel
+    };
+}
+
+namespace kernel::internal::stream_buffer
+{
+    // Define maximum number of stream and message buffers (both share the same pool).
+    // Setting this value to 0 remove stream and message buffers from kernel.
+    constexpr size_t max_number{ KERNEL_STREAM_BUFFER_MAX_NUMBER};
+
+    // Define priority of internal critical section.
+    // It should be equal or higher than interrupt using stream or message buffer API.
+    constexpr auto critical_section_priority{
+        kernel::hardware::interrupt::priority::Preemption::Kernel
+    };
+}
+
+namespace kernel::internal::queue_set
+{
+    // Define maximum number of queue sets.
+    // Setting this value to 0 remove queue sets from kernel.
+    constexpr size_t max_number{ KERNEL_QUEUE_SET_MAX_NUMBER};
+
+    // Define priority of internal critical section.
+    // It should be equal or higher than interrupts sending to member queues or setting member events.
+    constexpr auto critical_section_priority{
+        kernel::hardware::interrupt::priority::Preemption::Kernel
+    };
+}
+
+namespace kernel::internal::registry
+{
+    // Define maximum number of named objects and handle bindings.
+    // Keep it bigger than actually used, since lookup gets slower as registry fills up.
+    constexpr uint32_t max_number{ KERNEL_NAME_REGISTRY_SIZE};
+
+    // Setting this value to 0 remove name registry from kernel.
+    static_assert( 0U == ( max_number & ( max_number - 1U)), "Name registry size must be 0 or a power of two!");
+
+    // Define priority of internal critical section.
+    // It should be equal or higher than interrupt opening named objects.
+    constexpr auto critical_section_priority{
+        kernel::hardware::interrupt::priority::Preemption::Kernel
+    };
+}
+
 namespace kernel::internal::scheduler::wait
 {
     // Define maximum waitable signals by task.
     // Main use: WaitForObject functions.
-    constexpr uint32_t max_input_signals{ 8U};
+    constexpr uint32_t max_input_signals{ KERNEL_WAIT_MAX_INPUT_SIGNALS};
+
+    static_assert( max_input_signals > 0U, "Task must be able to wait for at least one signal!");
 }
 
 namespace kernel::error
 {
     // Enable kernel API error messages.
-    constexpr bool debug_messages_enable{ true};
+    constexpr bool debug_messages_enable{ 0 != KERNEL_DEBUG_MESSAGES_ENABLE};
 }
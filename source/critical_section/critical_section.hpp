@@ -0,0 +1,156 @@
+#pragma once
+
+#include "hardware/hardware.hpp"
+
+#include <cassert>
+
+#include "../kernel.hpp"
+
+// Software critical section lock word handling.
+
+// Critical section is taken with single LDREX/STREX pair on m_owner, which holds index of
+// owner task, so uncontended enter and leave never call the kernel. Owner can enter again
+// without any exclusive access, only nesting count is incremented.
+
+// Kernel is used only after spinning failed, ie. when there is a waiter. Leave releases
+// critical section first and then tests waiter count, so waiter registered in the meantime
+// is never missed. Kernel then hands critical section over to the highest priority waiter
+// with tryLock on its behalf, so only that task is woken up.
+
+// Number of spins adapts to observed hold times: successful spin moves the limit towards
+// twice the number of spins it took, failed spin shrinks the limit, so on single core, where
+// owner cannot release the section while waiter is spinning, waiters block almost at once.
+namespace kernel::internal::critical_section
+{
+    using Context = kernel::critical_section::Context;
+
+    // Value of m_owner, when critical section is free.
+    constexpr uint32_t no_owner{ 0xFFFF'FFFFU};
+
+    // Spin limit is never adapted below this value, so owner released in the meantime
+    // (ie. by an interrupt or on other core) still can be detected.
+    constexpr uint32_t min_spin{ 4U};
+
+    inline void init( Context & a_context, uint32_t a_max_spin)
+    {
+        a_context.m_owner = no_owner;
+        a_context.m_lockCount = 0U;
+        a_context.m_waiters = 0U;
+        a_context.m_spinLockMax = ( a_max_spin > min_spin) ? a_max_spin : min_spin;
+        a_context.m_spinLock = a_context.m_spinLockMax;
+    }
+
+    inline bool isOwner( Context & a_context, uint32_t a_owner)
+    {
+        return ( a_owner == a_context.m_owner);
+    }
+
+    // Return 'true' if critical section was free and is now owned by a_owner.
+    inline bool tryLock( Context & a_context, uint32_t a_owner)
+    {
+        assert( no_owner != a_owner);
+
+        // Retry only spurious store failure, not a taken section.
+        while ( no_owner == a_context.m_owner)
+        {
+            if ( true == hardware::utility::compareAndSwap( a_context.m_owner, no_owner, a_owner))
+            {
+                a_context.m_lockCount = 1U;
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    // Return 'true' if critical section is now owned by a_owner, also when it already was.
+    inline bool tryEnter( Context & a_context, uint32_t a_owner)
+    {
+        if ( true == isOwner( a_context, a_owner))
+        {
+            ++a_context.m_lockCount;
+            return true;
+        }
+
+        return tryLock( a_context, a_owner);
+    }
+
+    // Try to take critical section up to m_spinLock times and adapt the limit.
+    inline bool spinEnter( Context & a_context, uint32_t a_owner)
+    {
+        const uint32_t spin_limit = a_context.m_spinLock;
+
+        for ( uint32_t i = 0U; i < spin_limit; ++i)
+        {
+            if ( true == tryLock( a_context, a_owner))
+            {
+                // Move limit 1/8 of the way to twice the observed spin count.
+                const uint32_t target = ( 2U * i < a_context.m_spinLockMax) ? 2U * i : a_context.m_spinLockMax;
+                uint32_t spin = spin_limit;
+
+                if ( target > spin)
+                {
+                    spin += ( target - spin + 7U) / 8U;
+                }
+                else
+                {
+                    spin -= ( spin - target + 7U) / 8U;
+                }
+
+                a_context.m_spinLock = ( spin > min_spin) ? spin : min_spin;
+
+                return true;
+            }
+        }
+
+        const uint32_t spin = spin_limit - ( spin_limit + 7U) / 8U;
+
+        a_context.m_spinLock = ( spin > min_spin) ? spin : min_spin;
+
+        return false;
+    }
+
+    // Waiter count is modified by several tasks, so it is updated with LDREX/STREX too.
+    inline void addWaiter( Context & a_context)
+    {
+        uint32_t waiters;
+
+        do
+        {
+            waiters = a_context.m_waiters;
+        }
+        while ( false == hardware::utility::compareAndSwap( a_context.m_waiters, waiters, waiters + 1U));
+    }
+
+    inline void removeWaiter( Context & a_context)
+    {
+        uint32_t waiters;
+
+        do
+        {
+            waiters = a_context.m_waiters;
+        }
+        while ( false == hardware::utility::compareAndSwap( a_context.m_waiters, waiters, waiters - 1U));
+    }
+
+    // Leave critical section by its owner. Return 'true' if it was released and there is a waiter,
+    // which has to be handed critical section over or woken up.
+    inline bool leave( Context & a_context)
+    {
+        assert( a_context.m_lockCount > 0U);
+
+        --a_context.m_lockCount;
+
+        if ( 0U != a_context.m_lockCount)
+        {
+            return false;
+        }
+
+        // Accesses done in critical section must complete before it is seen as free.
+        hardware::utility::memoryBarrier();
+
+        a_context.m_owner = no_owner;
+
+        return ( 0U != a_context.m_waiters);
+    }
+}
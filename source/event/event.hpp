@@ -33,7 +33,7 @@ namespace kernel::internal::event
         //       generalized internal::event or adding new specialized
         //       internal::auto_reset_event. For current project state it is unnecessary
         //       complexity.
-        volatile common::MemoryBuffer< Event, max_number> m_data{};
+        common::MemoryBuffer< Event, max_number> m_data{};
     };
 
     inline bool create(
@@ -56,7 +56,7 @@ namespace kernel::internal::event
         a_id = static_cast< Id>( new_item_id);
 
         // Initialize new object.
-        volatile Event & new_event = a_context.m_data.at( new_item_id);
+        Event & new_event = a_context.m_data.at( new_item_id);
 
         new_event.m_manual_reset = a_manual_reset;
         new_event.m_state = State::Reset;
@@ -65,6 +65,15 @@ namespace kernel::internal::event
         return true;
     }
 
+    // Return name given on create, or nullptr for unnamed event.
+    inline const char * getName( Context & a_context, Id & a_id)
+    {
+        kernel::hardware::CriticalSection critical_section{ critical_section_priority};
+
+        return a_context.m_data.at( static_cast< MemoryBufferIndex>( a_id)).mp_name;
+    }
+
+    // Find event by name pointer. Used only when name registry is disabled.
     inline bool open( Context & a_context, Id & a_id, const char * ap_name)
     {
         assert( nullptr != ap_name);
@@ -0,0 +1,191 @@
+#pragma once
+
+#include "config/config.hpp"
+#include "common/memory_buffer.hpp"
+
+#include <array>
+
+#include "../kernel.hpp"
+
+// Event Group implementation.
+
+// Event group holds 32 flag bits, so single object can replace up to 32 events. Flags are set
+// and cleared by tasks and hardware interrupts, so hardware level critical sections are used
+// for context access.
+
+// Task waits for a mask of flags with any or all semantic. Wait parameters are stored in
+// waiter table, indexed by task index, since each task can wait for at most one group at a
+// time. Scheduler tests waiter with single mask compare, using wait condition handle of type
+// EventGroupWaiter and task index.
+namespace kernel::internal::event_group
+{
+    // Type strong index of Event Group.
+    enum class Id : uint32_t{};
+
+    struct EventGroup
+    {
+        uint32_t    m_bits{ 0U};
+    };
+
+    struct Waiter
+    {
+        Id          m_group{};
+        uint32_t    m_mask{ 0U};
+        bool        m_wait_for_all{ false};
+        bool        m_is_waiting{ false};
+    };
+
+    // Type strong memory index for allocated Event Group type.
+    typedef common::MemoryBuffer< EventGroup, max_number>::Id MemoryBufferIndex;
+
+    struct Context
+    {
+        common::MemoryBuffer< EventGroup, max_number> m_data{};
+        // Note: Waiter table takes no memory, when event groups are disabled.
+        std::array< Waiter, ( max_number > 0U) ? task::max_number : 0U> m_waiters{};
+    };
+
+    // Return 'true' if any (or all) a_mask bits are set in a_bits.
+    constexpr bool isMatched( uint32_t a_bits, uint32_t a_mask, bool a_wait_for_all)
+    {
+        return ( true == a_wait_for_all) ?
+            ( a_mask == ( a_bits & a_mask)) :
+            ( 0U != ( a_bits & a_mask));
+    }
+
+    inline bool create( Context & a_context, Id & a_id)
+    {
+        kernel::hardware::CriticalSection critical_section{ critical_section_priority};
+
+        MemoryBufferIndex new_group_id;
+
+        if ( false == a_context.m_data.allocate( new_group_id))
+        {
+            return false;
+        }
+
+        a_id = static_cast< Id>( new_group_id);
+
+        a_context.m_data.at( new_group_id).m_bits = 0U;
+
+        return true;
+    }
+
+    inline void destroy( Context & a_context, Id & a_id)
+    {
+        kernel::hardware::CriticalSection critical_section{ critical_section_priority};
+
+        a_context.m_data.free( static_cast< MemoryBufferIndex>( a_id));
+    }
+
+    // Return group bits after they were set.
+    inline uint32_t set( Context & a_context, Id & a_id, uint32_t a_bits)
+    {
+        kernel::hardware::CriticalSection critical_section{ critical_section_priority};
+
+        EventGroup & group = a_context.m_data.at( static_cast< MemoryBufferIndex>( a_id));
+
+        group.m_bits |= a_bits;
+
+        return group.m_bits;
+    }
+
+    // Return group bits before they were cleared.
+    inline uint32_t clear( Context & a_context, Id & a_id, uint32_t a_bits)
+    {
+        kernel::hardware::CriticalSection critical_section{ critical_section_priority};
+
+        EventGroup & group = a_context.m_data.at( static_cast< MemoryBufferIndex>( a_id));
+
+        const uint32_t bits = group.m_bits;
+
+        group.m_bits = bits & ~a_bits;
+
+        return bits;
+    }
+
+    inline uint32_t get( Context & a_context, Id & a_id)
+    {
+        kernel::hardware::CriticalSection critical_section{ critical_section_priority};
+
+        return a_context.m_data.at( static_cast< MemoryBufferIndex>( a_id)).m_bits;
+    }
+
+    // Store group bits in a_bits and return 'true' if wait condition is met. On success a_mask
+    // bits are cleared, when a_clear_on_exit is set, so only one waiter consumes them.
+    inline bool testAndClear(
+        Context &   a_context,
+        Id &        a_id,
+        uint32_t    a_mask,
+        bool        a_wait_for_all,
+        bool        a_clear_on_exit,
+        uint32_t &  a_bits
+    )
+    {
+        kernel::hardware::CriticalSection critical_section{ critical_section_priority};
+
+        EventGroup & group = a_context.m_data.at( static_cast< MemoryBufferIndex>( a_id));
+
+        a_bits = group.m_bits;
+
+        if ( false == isMatched( a_bits, a_mask, a_wait_for_all))
+        {
+            return false;
+        }
+
+        if ( true == a_clear_on_exit)
+        {
+            group.m_bits &= ~a_mask;
+        }
+
+        return true;
+    }
+
+    inline void registerWaiter(
+        Context &   a_context,
+        uint32_t    a_waiter,
+        Id &        a_id,
+        uint32_t    a_mask,
+        bool        a_wait_for_all
+    )
+    {
+        assert( a_waiter < task::max_number);
+
+        kernel::hardware::CriticalSection critical_section{ critical_section_priority};
+
+        Waiter & waiter = a_context.m_waiters[ a_waiter];
+
+        waiter.m_group = a_id;
+        waiter.m_mask = a_mask;
+        waiter.m_wait_for_all = a_wait_for_all;
+        waiter.m_is_waiting = true;
+    }
+
+    inline void unregisterWaiter( Context & a_context, uint32_t a_waiter)
+    {
+        assert( a_waiter < task::max_number);
+
+        kernel::hardware::CriticalSection critical_section{ critical_section_priority};
+
+        a_context.m_waiters[ a_waiter].m_is_waiting = false;
+    }
+
+    // Return 'true' if wait condition of registered waiter is met.
+    inline bool isWaiterSignaled( Context & a_context, uint32_t a_waiter)
+    {
+        assert( a_waiter < task::max_number);
+
+        kernel::hardware::CriticalSection critical_section{ critical_section_priority};
+
+        const Waiter & waiter = a_context.m_waiters[ a_waiter];
+
+        if ( false == waiter.m_is_waiting)
+        {
+            return false;
+        }
+
+        const uint32_t bits = a_context.m_data.at( static_cast< MemoryBufferIndex>( waiter.m_group)).m_bits;
+
+        return isMatched( bits, waiter.m_mask, waiter.m_wait_for_all);
+    }
+}
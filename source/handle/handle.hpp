@@ -2,7 +2,15 @@
 
 #include "timer/timer.hpp"
 #include "event/event.hpp"
+#include "event_group/event_group.hpp"
+#include "semaphore/semaphore.hpp"
+#include "rw_lock/rw_lock.hpp"
 #include "queue/queue.hpp"
+#include "ring_buffer/ring_buffer.hpp"
+#include "mpsc_queue/mpsc_queue.hpp"
+#include "priority_queue/priority_queue.hpp"
+#include "stream_buffer/stream_buffer.hpp"
+#include "queue_set/queue_set.hpp"
 
 #include "../kernel.hpp"
 
@@ -17,7 +25,52 @@ namespace kernel::internal::handle
         Task,
         Timer,
         Event,
-        Queue
+        Queue,
+        RingBuffer,
+        // Wait condition of blocking queue send. It is signaled when queue is not full.
+        // Index is the same as Queue index.
+        QueueNotFull,
+        PriorityQueue,
+        StreamBuffer,
+        // Index is Stream Buffer index. Both share the same internal object.
+        MessageBuffer,
+        QueueSet,
+        MpscQueue,
+        EventGroup,
+        // Wait condition of event group wait. It is signaled when waiter mask is matched.
+        // Index is index of waiting task.
+        EventGroupWaiter,
+        // Wait condition of task notification wait. Index is index of waiting task.
+        TaskNotification,
+        Semaphore,
+        // Signaled when lock can be read.
+        RwLock,
+        // Wait condition of write lock. It is signaled when lock is free.
+        // Index is the same as RwLock index.
+        RwLockWriter,
+        // Wait condition of receiver registered for queue direct handoff. It is signaled when
+        // item was handed off to it or queue is triggered. Index is the same as Queue index.
+        QueueReceiver,
+        // Wait condition of blocking stream buffer send. It is signaled when buffer is not full.
+        // Index is the same as StreamBuffer index.
+        StreamBufferNotFull
+    };
+
+    // Contexts of system objects, which can be pointed by handle and waited for.
+    // Note: Tasks are not waitable and are kept outside.
+    struct Context
+    {
+        internal::timer::Context            m_timers{};
+        internal::event::Context            m_events{};
+        internal::event_group::Context      m_event_groups{};
+        internal::semaphore::Context        m_semaphores{};
+        internal::rw_lock::Context          m_rw_locks{};
+        internal::queue::Context            m_queues{};
+        internal::ring_buffer::Context      m_ring_buffers{};
+        internal::mpsc_queue::Context       m_mpsc_queues{};
+        internal::priority_queue::Context   m_priority_queues{};
+        internal::stream_buffer::Context    m_stream_buffers{};
+        internal::queue_set::Context        m_queue_sets{};
     };
     
     template < typename TIndexType>
@@ -28,7 +81,7 @@ namespace kernel::internal::handle
         return static_cast< kernel::Handle>( handle_value);
     }
 
-    inline ObjectType getObjectType( volatile kernel::Handle & a_handle)
+    inline ObjectType getObjectType( const kernel::Handle & a_handle)
     {
         uint32_t object_type = ( static_cast< uint32_t>( a_handle) >> 16U) & 0xFFFFU;
         return static_cast< ObjectType>( object_type);
@@ -36,7 +89,7 @@ namespace kernel::internal::handle
 
     // Strong typed version of getIndex.
     template< typename TId>
-    inline TId getId( volatile Handle & a_handle)
+    inline TId getId( const Handle & a_handle)
     {
         uint32_t id_value = static_cast< uint32_t>( a_handle) & 0xFFFFU;
         return static_cast< TId>( id_value);
@@ -44,12 +97,36 @@ namespace kernel::internal::handle
 
     // Test if system object pointed by handle is in signaled state.
     // Return value indicate if Handle type is supported.
+    // Queue set member is ready when queue is not empty, regardless of its trigger level,
+    // or when event is set.
+    inline bool isQueueSetMemberReady( Context & a_context, const kernel::Handle & a_member)
+    {
+        switch ( internal::handle::getObjectType( a_member))
+        {
+        case internal::handle::ObjectType::Queue:
+        {
+            auto queue_id = internal::handle::getId< internal::queue::Id>( a_member);
+            return ( false == internal::queue::isEmpty( a_context.m_queues, queue_id));
+        }
+        case internal::handle::ObjectType::Event:
+        {
+            auto event_id = internal::handle::getId< internal::event::Id>( a_member);
+            return internal::event::isSignaled( a_context.m_events, event_id);
+        }
+        default:
+            return false;
+        }
+    }
+
+    // Note: Handle of disabled object type (maximum number set to 0) is not supported. Code
+    //       after 'if constexpr' is still compiled, since this is not a template, and it stays
+    //       valid thanks to empty MemoryBuffer of disabled object type.
+    // a_current is system time used by queue batch timeout.
     inline bool testCondition(
-        internal::timer::Context &  a_timer_context,
-        internal::event::Context &  a_event_context,
-        internal::queue::Context &  a_queue_context,
-        volatile kernel::Handle &   a_handle,
-        bool &                      a_condition_fulfilled
+        Context &                   a_context,
+        const kernel::Handle &      a_handle,
+        bool &                      a_condition_fulfilled,
+        TimeMs                      a_current = 0U
     )
     {
         const auto objectType = internal::handle::getObjectType( a_handle);
@@ -60,15 +137,25 @@ namespace kernel::internal::handle
         {
         case internal::handle::ObjectType::Event:
         {
+            if constexpr ( 0U == internal::event::max_number)
+            {
+                return false;
+            }
+
             auto event_id = internal::handle::getId< internal::event::Id>( a_handle);
-            a_condition_fulfilled = internal::event::isSignaled( a_event_context, event_id);
+            a_condition_fulfilled = internal::event::isSignaled( a_context.m_events, event_id);
 
             break;
         }
         case internal::handle::ObjectType::Timer:
         {
+            if constexpr ( 0U == internal::timer::max_number)
+            {
+                return false;
+            }
+
             auto timer_id = internal::handle::getId< internal::timer::Id>( a_handle);
-            auto timerState = internal::timer::getState( a_timer_context, timer_id);
+            auto timerState = internal::timer::getState( a_context.m_timers, timer_id);
 
             if ( internal::timer::State::Finished == timerState)
             {
@@ -77,19 +164,213 @@ namespace kernel::internal::handle
 
             break;
         }
-        // Signal task if queue is not empty.
+        // Signal task if queue reached its trigger level (by default it is not empty),
+        // or batch timeout elapsed.
         case internal::handle::ObjectType::Queue:
         {
+            if constexpr ( 0U == internal::queue::max_number)
+            {
+                return false;
+            }
+
             auto queue_id = internal::handle::getId< internal::queue::Id>( a_handle);
-            bool is_queue_empty = internal::queue::isEmpty( a_queue_context, queue_id);
+            a_condition_fulfilled = internal::queue::isTriggered( a_context.m_queues, queue_id, a_current);
+
+            break;
+        }
+        // Signal registered receiver if item was handed off to it, or queue is triggered.
+        case internal::handle::ObjectType::QueueReceiver:
+        {
+            if constexpr ( 0U == internal::queue::max_number)
+            {
+                return false;
+            }
+
+            auto queue_id = internal::handle::getId< internal::queue::Id>( a_handle);
+
+            a_condition_fulfilled = ( true == internal::queue::isHandoffDone( a_context.m_queues, queue_id)) ||
+                ( true == internal::queue::isTriggered( a_context.m_queues, queue_id, a_current));
+
+            break;
+        }
+        // Signal task if queue is not full.
+        case internal::handle::ObjectType::QueueNotFull:
+        {
+            if constexpr ( 0U == internal::queue::max_number)
+            {
+                return false;
+            }
+
+            auto queue_id = internal::handle::getId< internal::queue::Id>( a_handle);
+            bool is_queue_full = internal::queue::isFull( a_context.m_queues, queue_id);
+
+            if ( false == is_queue_full)
+            {
+                a_condition_fulfilled = true;
+            }
+
+            break;
+        }
+        // Signal task if ring buffer is not empty.
+        case internal::handle::ObjectType::RingBuffer:
+        {
+            if constexpr ( 0U == internal::ring_buffer::max_number)
+            {
+                return false;
+            }
+
+            auto ring_buffer_id = internal::handle::getId< internal::ring_buffer::Id>( a_handle);
+            bool is_ring_buffer_empty = internal::ring_buffer::isEmpty( a_context.m_ring_buffers, ring_buffer_id);
+
+            if ( false == is_ring_buffer_empty)
+            {
+                a_condition_fulfilled = true;
+            }
+
+            break;
+        }
+        // Signal task if MPSC queue has published item.
+        case internal::handle::ObjectType::MpscQueue:
+        {
+            if constexpr ( 0U == internal::mpsc_queue::max_number)
+            {
+                return false;
+            }
+
+            auto mpsc_queue_id = internal::handle::getId< internal::mpsc_queue::Id>( a_handle);
+            bool is_mpsc_queue_empty = internal::mpsc_queue::isEmpty( a_context.m_mpsc_queues, mpsc_queue_id);
+
+            if ( false == is_mpsc_queue_empty)
+            {
+                a_condition_fulfilled = true;
+            }
 
-            if ( false == is_queue_empty)
+            break;
+        }
+        // Signal task if priority queue is not empty.
+        case internal::handle::ObjectType::PriorityQueue:
+        {
+            if constexpr ( 0U == internal::priority_queue::max_number)
+            {
+                return false;
+            }
+
+            auto priority_queue_id = internal::handle::getId< internal::priority_queue::Id>( a_handle);
+            bool is_priority_queue_empty = internal::priority_queue::isEmpty( a_context.m_priority_queues, priority_queue_id);
+
+            if ( false == is_priority_queue_empty)
             {
                 a_condition_fulfilled = true;
             }
 
             break;
         }
+        // Signal task if stream or message buffer reached its trigger level.
+        case internal::handle::ObjectType::StreamBuffer:
+        case internal::handle::ObjectType::MessageBuffer:
+        {
+            if constexpr ( 0U == internal::stream_buffer::max_number)
+            {
+                return false;
+            }
+
+            auto stream_buffer_id = internal::handle::getId< internal::stream_buffer::Id>( a_handle);
+            a_condition_fulfilled = internal::stream_buffer::isTriggered( a_context.m_stream_buffers, stream_buffer_id);
+
+            break;
+        }
+        // Signal task if stream buffer is not full.
+        case internal::handle::ObjectType::StreamBufferNotFull:
+        {
+            if constexpr ( 0U == internal::stream_buffer::max_number)
+            {
+                return false;
+            }
+
+            auto stream_buffer_id = internal::handle::getId< internal::stream_buffer::Id>( a_handle);
+            a_condition_fulfilled = ( false == internal::stream_buffer::isFull( a_context.m_stream_buffers, stream_buffer_id));
+
+            break;
+        }
+        // Signal task if any member of queue set is ready. Members drained without select
+        // are dropped from the set here.
+        case internal::handle::ObjectType::QueueSet:
+        {
+            if constexpr ( 0U == internal::queue_set::max_number)
+            {
+                return false;
+            }
+
+            auto queue_set_id = internal::handle::getId< internal::queue_set::Id>( a_handle);
+
+            a_condition_fulfilled = internal::queue_set::hasReadyMember(
+                a_context.m_queue_sets,
+                queue_set_id,
+                [ &a_context]( const kernel::Handle & a_member)
+                {
+                    return isQueueSetMemberReady( a_context, a_member);
+                }
+            );
+
+            break;
+        }
+        // Signal task if flags of event group match its wait mask.
+        case internal::handle::ObjectType::EventGroupWaiter:
+        {
+            if constexpr ( 0U == internal::event_group::max_number)
+            {
+                return false;
+            }
+
+            auto waiter_index = internal::handle::getId< uint32_t>( a_handle);
+            a_condition_fulfilled = internal::event_group::isWaiterSignaled( a_context.m_event_groups, waiter_index);
+
+            break;
+        }
+        // Signal task if semaphore count is positive. Count is not taken here.
+        case internal::handle::ObjectType::Semaphore:
+        {
+            if constexpr ( 0U == internal::semaphore::max_number)
+            {
+                return false;
+            }
+
+            auto semaphore_id = internal::handle::getId< internal::semaphore::Id>( a_handle);
+            a_condition_fulfilled = internal::semaphore::isAvailable( a_context.m_semaphores, semaphore_id);
+
+            break;
+        }
+        // Signal task if lock can be taken. Lock is not taken here.
+        case internal::handle::ObjectType::RwLock:
+        {
+            if constexpr ( 0U == internal::rw_lock::max_number)
+            {
+                return false;
+            }
+
+            auto rw_lock_id = internal::handle::getId< internal::rw_lock::Id>( a_handle);
+            a_condition_fulfilled = internal::rw_lock::isReadAvailable( a_context.m_rw_locks, rw_lock_id);
+
+            break;
+        }
+        case internal::handle::ObjectType::RwLockWriter:
+        {
+            if constexpr ( 0U == internal::rw_lock::max_number)
+            {
+                return false;
+            }
+
+            auto rw_lock_id = internal::handle::getId< internal::rw_lock::Id>( a_handle);
+            a_condition_fulfilled = internal::rw_lock::isWriteAvailable( a_context.m_rw_locks, rw_lock_id);
+
+            break;
+        }
+        // Task notification is never signaled here. Notified task is woken up directly,
+        // so only timeout is tested.
+        case internal::handle::ObjectType::TaskNotification:
+        {
+            break;
+        }
         default:
         {
             return false;
@@ -101,9 +382,8 @@ namespace kernel::internal::handle
 
     // Reset state of system object pointed by provided handle.
     inline void resetState(
-        internal::timer::Context &  a_timer_context,
-        internal::event::Context &  a_event_context,
-        volatile kernel::Handle &   a_handle
+        Context &                   a_context,
+        const kernel::Handle &      a_handle
     )
     {
         const auto objectType = internal::handle::getObjectType( a_handle);
@@ -112,15 +392,25 @@ namespace kernel::internal::handle
         {
         case internal::handle::ObjectType::Event:
         {
+            if constexpr ( 0U == internal::event::max_number)
+            {
+                break;
+            }
+
             auto event_id = internal::handle::getId< internal::event::Id>( a_handle);
-            internal::event::manualReset( a_event_context, event_id);
+            internal::event::manualReset( a_context.m_events, event_id);
 
             break;
         }
         case internal::handle::ObjectType::Timer:
         {
+            if constexpr ( 0U == internal::timer::max_number)
+            {
+                break;
+            }
+
             auto timer_id = internal::handle::getId< internal::timer::Id>( a_handle);
-            internal::timer::stop( a_timer_context, timer_id);
+            internal::timer::stop( a_context.m_timers, timer_id);
 
             break;
         }
@@ -14,6 +14,18 @@ volatile kernel::internal::hardware::task::Context * next_task_context;
 
 namespace
 {
+    // PendSV is pended both for context switch prepared by kernel and for reschedule requested
+    // by interrupt routine. Both flags are changed only by kernel handlers, which share the same
+    // priority, or set before PendSV is pended.
+    volatile bool is_context_switch_pending{ false};
+    volatile bool is_reschedule_pending{ false};
+
+    void pendContextSwitch()
+    {
+        is_context_switch_pending = true;
+        SCB->ICSR |= SCB_ICSR_PENDSVSET_Msk; // Set PendSV interrupt to pending state.
+    }
+
     // Variables used to calculate SysTick prescaler to reach 1 ms timestamp.
     // This is derived from formula:
     // TARGET_SYSTICK_TIMESTAMP_HZ = CORE_CLOCK_FREQ_HZ / SYSTICK_PRESCALER,
@@ -192,7 +204,7 @@ namespace kernel::internal::hardware
 
         void start()
         {
-            // Note: Enable SysTick last, since it is the only PendSV trigger.
+            // Note: Enable SysTick last, since it triggers the first PendSV.
             NVIC_EnableIRQ( SVCall_IRQn);
             NVIC_EnableIRQ( PendSV_IRQn);
             NVIC_EnableIRQ( SysTick_IRQn);
@@ -201,7 +213,7 @@ namespace kernel::internal::hardware
 
     void syscall( SyscallId a_id)
     {
-        __ASM(" DMB"); // Complete all explicit memory transfers
+        __DMB(); // Complete all explicit memory transfers. It is also compiler barrier for kernel data.
         
         switch( a_id)
         {
@@ -214,6 +226,12 @@ namespace kernel::internal::hardware
         }
     }
 
+    void pendReschedule()
+    {
+        is_reschedule_pending = true;
+        SCB->ICSR |= SCB_ICSR_PENDSVSET_Msk; // Set PendSV interrupt to pending state.
+    }
+
     void init()
     {
         SysTick_Config( systick_prescaler - 1U);
@@ -275,6 +293,24 @@ namespace kernel::internal::hardware
         {
             __DMB();
         }
+
+        bool compareAndSwap( volatile uint32_t & a_value, uint32_t a_expected, uint32_t a_desired)
+        {
+            if ( a_expected != __LDREXW( &a_value))
+            {
+                __CLREX();
+                return false;
+            }
+
+            // Exception entry and return clear exclusive monitor, so store fails if any
+            // interrupt run between load and store.
+            return ( 0U == __STREXW( a_desired, &a_value));
+        }
+
+        bool isHandlerMode()
+        {
+            return ( 0U != __get_IPSR());
+        }
     }
 }
 
@@ -368,7 +404,7 @@ extern "C"
                 kernel::internal::switchContext();
                 __DSB(); // Complete unfinished memory transfers from switchContext.
                 __ISB(); // Flush instructions in pipeline before entering PendSV.
-                SCB->ICSR |= SCB_ICSR_PENDSVSET_Msk; // Set PendSV_Handler to pending state so it can tail chain from SVC.
+                pendContextSwitch(); // Set PendSV_Handler to pending state so it can tail chain from SVC.
                 break;
             }
             default:      // unknown SVC
@@ -389,19 +425,55 @@ extern "C"
 
     void SysTick_Handler(void)
     {
+        // SysTick is never pended by software, so each call is one elapsed millisecond.
         // TODO: Make this function explicitly inline.
-        bool execute_context_switch = kernel::internal::tick();
+        bool execute_context_switch = kernel::internal::tick( true);
 
         __DSB(); // Complete unfinished memory transfers from tick function.
 
         if ( execute_context_switch)
         {
-            SCB->ICSR |= SCB_ICSR_PENDSVSET_Msk; // Set PendSV interrupt to pending state.
+            pendContextSwitch();
         }
     }
+
+    // Called by PendSV before context is switched. Return 'false' if there is nothing to switch.
+    bool PendSV_Handler_Main(void)
+    {
+        if ( true == is_context_switch_pending)
+        {
+            is_context_switch_pending = false;
+
+            // Context switch is already prepared, so reschedule runs after it, in the next PendSV.
+            if ( true == is_reschedule_pending)
+            {
+                SCB->ICSR |= SCB_ICSR_PENDSVSET_Msk; // Set PendSV interrupt to pending state.
+            }
+
+            return true;
+        }
+
+        is_reschedule_pending = false;
+
+        bool execute_context_switch = kernel::internal::tick( false);
+
+        __DSB(); // Complete unfinished memory transfers from tick function.
+
+        return execute_context_switch;
+    }
     
     __attribute__ (( naked )) void PendSV_Handler(void) // Use 'naked' attribute to remove C ABI, because return from interrupt must be set manually.
     {
+        // Run pended reschedule. Callee saves r4-r11, so they still hold current task context.
+        __ASM(" PUSH {r4, lr}\n"); // r4 is pushed only to keep stack 8 byte aligned.
+        __ASM(" BL PendSV_Handler_Main\n");
+        __ASM(" POP {r4, lr}\n");
+
+        // Return to current task, if there is nothing to switch.
+        __ASM(" CMP r0, #0\n"
+        " IT EQ\n"
+        " BXEQ lr\n");
+
         __ASM(" CPSID I\n");
         
         // Store current task at address provided by current_task_context.
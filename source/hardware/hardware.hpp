@@ -5,9 +5,11 @@
 namespace kernel::internal
 {
     // Kernel Handler Mode interfaces.
+    // a_is_time_elapsed is 'false' when reschedule was pended by interrupt routine or lock
+    // release. Then system time is not incremented.
     void loadNextTask();
     void switchContext();
-    bool tick();
+    bool tick( bool a_is_time_elapsed);
 }
 
 namespace kernel::internal::hardware
@@ -40,6 +42,10 @@ namespace kernel::internal::hardware
     // When called while interrupts are disabled will cause HardFault exception.
     void syscall( SyscallId a_id);
 
+    // Pend kernel reschedule, so kernel checks wait conditions as soon as interrupt routine
+    // exits, instead of on the next tick. It is run by PendSV, so SysTick only counts time.
+    void pendReschedule();
+
     void init();
     void start();
 
@@ -62,5 +68,13 @@ namespace kernel::internal::hardware
     namespace utility
     {
         void memoryBarrier();
+
+        // Store a_desired to a_value, only if it still holds a_expected. Return 'false' if value
+        // was different or store failed, ie. exclusive access was broken by an interrupt.
+        // Failure can be spurious, so it should be called in a retry loop.
+        bool compareAndSwap( volatile uint32_t & a_value, uint32_t a_expected, uint32_t a_desired);
+
+        // Return 'true' if called from interrupt routine.
+        bool isHandlerMode();
     }
 }
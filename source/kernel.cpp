@@ -7,7 +7,16 @@
 #include "scheduler/scheduler.hpp"
 #include "timer/timer.hpp"
 #include "event/event.hpp"
+#include "event_group/event_group.hpp"
+#include "semaphore/semaphore.hpp"
+#include "rw_lock/rw_lock.hpp"
 #include "queue/queue.hpp"
+#include "ring_buffer/ring_buffer.hpp"
+#include "mpsc_queue/mpsc_queue.hpp"
+#include "priority_queue/priority_queue.hpp"
+#include "stream_buffer/stream_buffer.hpp"
+#include "critical_section/critical_section.hpp"
+#include "registry/registry.hpp"
 #include "lock/lock.hpp"
 
 // Print error in case of wrong kernel API usage.
@@ -31,15 +40,25 @@ namespace kernel::internal::context
     internal::system_timer::Context m_systemTimer;
     internal::task::Context         m_tasks;
     internal::scheduler::Context    m_scheduler;
-    internal::timer::Context        m_timers;
-    internal::event::Context        m_events;
-    internal::queue::Context        m_queue;
+    internal::handle::Context       m_objects; // Timers, events and all kinds of queues.
     internal::lock::Context         m_lock;
+    internal::registry::Context     m_registry; // Named objects and handle bindings.
 
     // Indicate if kernel has been started. It is used to detect if
     // system object was created before or after kernel::start and also
     // for some sanity checks.
     bool m_started = false;
+
+    // Indicate that task was notified from interrupt, or before it started waiting, so
+    // notified tasks are woken up by the next system tick or pended reschedule.
+    volatile bool m_notification_pending = false;
+
+    // Indicate that interrupt routine changed kernel object, which task could wait for.
+    volatile bool m_reschedule_pending = false;
+
+    // Timer service task is created by init, if timer callbacks are enabled.
+    bool m_timer_task_created = false;
+    internal::task::Id m_timer_task;
 }
 
 // Declarations of internal kernel functions.
@@ -47,7 +66,35 @@ namespace kernel::internal
 {
     void taskRoutine();
     void idleTaskRoutine( void * a_parameter);
+    void timerTaskRoutine( void * a_parameter);
+    bool createTimerTask();
     void terminateTask( task::Id a_id);
+    void wakeQueueReceiver( kernel::Handle & a_receiver);
+    void wakeNotifiedTask( task::Id & a_id);
+    void wakeNotifiedTasks();
+    void requestReschedule();
+    bool setQueueTriggerLevel( kernel::Handle & a_handle, size_t a_trigger_level, bool a_has_batch_timeout, TimeMs a_batch_timeout);
+
+    bool createStreamBuffer(
+        kernel::Handle &        a_handle,
+        handle::ObjectType      a_object_type,
+        size_t                  a_data_max_size,
+        void * const            ap_static_buffer,
+        size_t                  a_trigger_level
+    );
+    void destroyStreamBuffer( kernel::Handle & a_handle, handle::ObjectType a_object_type);
+    bool setStreamBufferTriggerLevel( kernel::Handle & a_handle, handle::ObjectType a_object_type, size_t a_trigger_level);
+
+    bool registerName( const kernel::Handle & a_handle, const kernel::Name & a_name);
+    void unregisterName( const char * const ap_name);
+    bool openByName( kernel::Handle & a_handle, const kernel::Name & a_name, handle::ObjectType a_object_type);
+
+    bool getQueueSetSlot( const kernel::Handle & a_member, uint32_t & a_slot);
+    void notifyQueueSet( const kernel::Handle & a_member);
+    void leaveQueueSet( const kernel::Handle & a_member);
+    bool isQueueSetMemberReady( const kernel::Handle & a_member);
+    void requeueLastSelected( queue_set::Id & a_id);
+    bool takeReadyMember( const kernel::Handle & a_member);
 }
 
 // User API implementations.
@@ -71,6 +118,16 @@ namespace kernel
             hardware::debug::setBreakpoint();
             assert( true);
         }
+
+        if constexpr ( internal::timer::callback_enable)
+        {
+            if ( false == internal::createTimerTask())
+            {
+                error::print( "Critical Error! Failed to create timer service task!\n");
+                hardware::debug::setBreakpoint();
+                assert( true);
+            }
+        }
     }
     
     void start()
@@ -100,6 +157,31 @@ namespace kernel
     {
         return kernel::internal::hardware::core_clock_freq_hz;
     }
+
+    // Note: No lock is required since internal::registry API is already protected.
+    bool bind( kernel::Handle & a_handle, const kernel::Name & a_name)
+    {
+        if ( nullptr == a_name.mp_string)
+        {
+            error::print( "Invalid argument! Empty pointer to object name!\n");
+            return false;
+        }
+
+        if constexpr ( 0U == internal::registry::max_number)
+        {
+            error::print( "Name registry is disabled! Set KERNEL_NAME_REGISTRY_SIZE.\n");
+            return false;
+        }
+
+        bool handle_bound = internal::registry::bind( internal::context::m_registry, a_name, a_handle);
+
+        if ( false == handle_bound)
+        {
+            error::print( "Failed to bind handle! Name registry is full or name is already bound.\n");
+        }
+
+        return handle_bound;
+    }
 }
 
 namespace kernel::task
@@ -341,6 +423,92 @@ namespace kernel::task
         }
         internal::hardware::syscall( internal::hardware::SyscallId::ExecuteContextSwitch);
     }
+
+    bool notify( kernel::Handle & a_handle, uint32_t a_value, kernel::task::NotifyAction a_action)
+    {
+        const auto object_type = internal::handle::getObjectType( a_handle);
+
+        if ( internal::handle::ObjectType::Task != object_type)
+        {
+            error::print( "Invalid handle! Underlying object type is not supported by this function.\n");
+            return false;
+        }
+
+        auto notified_task_id = internal::handle::getId< internal::task::Id>( a_handle);
+
+        internal::task::notification::notify( internal::context::m_tasks, notified_task_id, a_value, a_action);
+
+        internal::wakeNotifiedTask( notified_task_id);
+        internal::requestReschedule();
+
+        return true;
+    }
+
+    // Note: Notification can come before task is Waiting. It is then woken up by the next tick.
+    kernel::sync::WaitResult notifyWait(
+        uint32_t &      a_value,
+        bool            a_clear_on_exit,
+        bool            a_wait_forever,
+        TimeMs          a_timeout
+    )
+    {
+        auto current_task_id = internal::handle::getId< internal::task::Id>( getCurrent());
+
+        if ( true == internal::task::notification::take( internal::context::m_tasks, current_task_id, a_clear_on_exit, a_value))
+        {
+            return sync::WaitResult::ObjectSet;
+        }
+
+        if ( ( false == a_wait_forever) && ( 0U == a_timeout))
+        {
+            return sync::WaitResult::TimeoutOccurred;
+        }
+
+        const TimeMs start_time = getTime();
+
+        kernel::Handle notification_condition = internal::handle::create(
+            internal::handle::ObjectType::TaskNotification,
+            current_task_id
+        );
+
+        internal::task::notification::setWaiting( internal::context::m_tasks, current_task_id, true);
+
+        sync::WaitResult result = sync::WaitResult::TimeoutOccurred;
+
+        while ( true)
+        {
+            // Notifier could miss waiting flag before the first check.
+            if ( true == internal::task::notification::take( internal::context::m_tasks, current_task_id, a_clear_on_exit, a_value))
+            {
+                result = sync::WaitResult::ObjectSet;
+                break;
+            }
+
+            TimeMs remaining_time = 0U;
+
+            if ( false == a_wait_forever)
+            {
+                const TimeMs elapsed_time = getTime() - start_time;
+
+                if ( elapsed_time >= a_timeout)
+                {
+                    break;
+                }
+
+                remaining_time = a_timeout - elapsed_time;
+            }
+
+            if ( sync::WaitResult::WaitFailed == sync::waitForSingleObject( notification_condition, a_wait_forever, remaining_time))
+            {
+                result = sync::WaitResult::WaitFailed;
+                break;
+            }
+        }
+
+        internal::task::notification::setWaiting( internal::context::m_tasks, current_task_id, false);
+
+        return result;
+    }
 }
 
 namespace kernel::timer
@@ -354,7 +522,7 @@ namespace kernel::timer
             internal::timer::Id new_timer_id;
 
             bool timer_created = internal::timer::create(
-                internal::context::m_timers,
+                internal::context::m_objects.m_timers,
                 new_timer_id,
                 current_time,
                 a_interval
@@ -374,6 +542,56 @@ namespace kernel::timer
         return true;
     }
 
+    bool create(
+        kernel::Handle &    a_handle,
+        TimeMs              a_interval,
+        Callback            a_callback,
+        void * const        a_parameter,
+        bool                a_auto_reload
+    )
+    {
+        if ( nullptr == a_callback)
+        {
+            error::print( "Invalid argument! Empty pointer to timer callback!\n");
+            return false;
+        }
+
+        if ( false == internal::context::m_timer_task_created)
+        {
+            error::print( "Timer callbacks are disabled! Set KERNEL_TIMER_CALLBACK_ENABLE.\n");
+            return false;
+        }
+
+        internal::lock::enter( internal::context::m_lock);
+        {
+            TimeMs current_time = internal::system_timer::get( internal::context::m_systemTimer);
+
+            internal::timer::Id new_timer_id;
+
+            bool timer_created = internal::timer::create(
+                internal::context::m_objects.m_timers,
+                new_timer_id,
+                current_time,
+                a_interval,
+                a_callback,
+                a_parameter,
+                a_auto_reload
+            );
+
+            if ( false == timer_created)
+            {
+                error::print( "Failed to internally create timer!\n");
+                internal::lock::leave( internal::context::m_lock);
+                return false;
+            }
+
+            a_handle = internal::handle::create( internal::handle::ObjectType::Timer, new_timer_id);
+        }
+        internal::lock::leave( internal::context::m_lock);
+
+        return true;
+    }
+
     void destroy( kernel::Handle & a_handle)
     {
         const auto object_type = internal::handle::getObjectType( a_handle);
@@ -387,7 +605,7 @@ namespace kernel::timer
         internal::lock::enter( internal::context::m_lock);
         {
             auto timer_id = internal::handle::getId< internal::timer::Id>( a_handle);
-            internal::timer::destroy( internal::context::m_timers, timer_id);
+            internal::timer::destroy( internal::context::m_objects.m_timers, timer_id);
         }
         internal::lock::leave( internal::context::m_lock);
     }
@@ -405,7 +623,7 @@ namespace kernel::timer
         internal::lock::enter( internal::context::m_lock);
         {
             auto timer_id = internal::handle::getId< internal::timer::Id>( a_handle);
-            internal::timer::start( internal::context::m_timers, timer_id);
+            internal::timer::start( internal::context::m_objects.m_timers, timer_id);
         }
         internal::lock::leave( internal::context::m_lock);
     }
@@ -423,7 +641,7 @@ namespace kernel::timer
         internal::lock::enter( internal::context::m_lock);
         {
             auto timer_id = internal::handle::getId< internal::timer::Id>( a_handle);
-            internal::timer::restart( internal::context::m_timers, timer_id);
+            internal::timer::restart( internal::context::m_objects.m_timers, timer_id);
         }
         internal::lock::leave( internal::context::m_lock);
     }
@@ -441,7 +659,7 @@ namespace kernel::timer
         internal::lock::enter( internal::context::m_lock);
         {
             auto timer_id = internal::handle::getId< internal::timer::Id>( a_handle);
-            internal::timer::stop( internal::context::m_timers, timer_id);
+            internal::timer::stop( internal::context::m_objects.m_timers, timer_id);
         }
         internal::lock::leave( internal::context::m_lock);
     }
@@ -450,15 +668,15 @@ namespace kernel::timer
 namespace kernel::event
 {
     // Note: No lock is required since internal::event API is already protected.
-    bool create( kernel::Handle & a_handle, bool a_manual_reset, const char * const a_name)
+    bool create( kernel::Handle & a_handle, bool a_manual_reset, const kernel::Name & a_name)
     {
         internal::event::Id new_event_id;
 
         bool event_created = internal::event::create(
-            internal::context::m_events,
+            internal::context::m_objects.m_events,
             new_event_id,
             a_manual_reset,
-            a_name
+            a_name.mp_string
         );
 
         if ( false == event_created)
@@ -467,29 +685,28 @@ namespace kernel::event
             return false;
         }
 
-        a_handle = internal::handle::create( internal::handle::ObjectType::Event, new_event_id);
+        kernel::Handle new_handle = internal::handle::create( internal::handle::ObjectType::Event, new_event_id);
+
+        if ( false == internal::registerName( new_handle, a_name))
+        {
+            internal::event::destroy( internal::context::m_objects.m_events, new_event_id);
+            return false;
+        }
+
+        a_handle = new_handle;
 
         return true;
     }
 
-    bool open( kernel::Handle & a_handle, const char * const ap_name)
+    bool open( kernel::Handle & a_handle, const kernel::Name & a_name)
     {
-        if ( nullptr == ap_name)
+        if ( nullptr == a_name.mp_string)
         {
             error::print( "Invalid argument! Empty pointer to event name!\n");
             return false;
         }
 
-        internal::event::Id event_id;
-
-        bool event_opened = internal::event::open( internal::context::m_events, event_id, ap_name);
-        
-        if ( true == event_opened)
-        {
-            a_handle = internal::handle::create( internal::handle::ObjectType::Event, event_id);
-        }
-
-        return event_opened;
+        return internal::openByName( a_handle, a_name, internal::handle::ObjectType::Event);
     }
 
     void destroy( kernel::Handle & a_handle)
@@ -503,7 +720,10 @@ namespace kernel::event
         }
 
         auto event_id = internal::handle::getId< internal::event::Id>( a_handle);
-        internal::event::destroy( internal::context::m_events, event_id);
+
+        internal::unregisterName( internal::event::getName( internal::context::m_objects.m_events, event_id));
+        internal::leaveQueueSet( a_handle);
+        internal::event::destroy( internal::context::m_objects.m_events, event_id);
     }
 
     void set( kernel::Handle & a_handle)
@@ -517,7 +737,10 @@ namespace kernel::event
         }
 
         auto event_id = internal::handle::getId< internal::event::Id>( a_handle);
-        internal::event::set( internal::context::m_events, event_id);
+        internal::event::set( internal::context::m_objects.m_events, event_id);
+
+        internal::notifyQueueSet( a_handle);
+        internal::requestReschedule();
     }
 
     void reset( kernel::Handle & a_handle)
@@ -531,7 +754,7 @@ namespace kernel::event
         }
 
         auto event_id = internal::handle::getId< internal::event::Id>( a_handle);
-        internal::event::reset( internal::context::m_events, event_id);
+        internal::event::reset( internal::context::m_objects.m_events, event_id);
     }
 }
 
@@ -543,9 +766,11 @@ namespace kernel::critical_section
         {
             internal::event::Id new_event_id;
 
-            // Create event used to wake up tasks waiting for a critical section.
+            // Create event used by tasks waiting for a critical section. Waiting task is usually
+            // handed critical section over directly. Event is set only, when waiter didn't start
+            // to wait yet.
             bool event_created = internal::event::create(
-                internal::context::m_events,
+                internal::context::m_objects.m_events,
                 new_event_id,
                 false,
                 nullptr
@@ -563,18 +788,7 @@ namespace kernel::critical_section
                 new_event_id
             );
 
-            internal::event::set( internal::context::m_events, new_event_id);
-
-            internal::task::Id current_task_id =
-                internal::scheduler::getCurrentTaskId( internal::context::m_scheduler);
-
-            a_context.m_ownerTask = internal::handle::create(
-                internal::handle::ObjectType::Task,
-                current_task_id
-            );
-
-            a_context.m_lockCount = 0U;
-            a_context.m_spinLock = a_spinLock;
+            internal::critical_section::init( a_context, a_spinLock);
         }
         internal::lock::leave( internal::context::m_lock);
 
@@ -592,57 +806,98 @@ namespace kernel::critical_section
 
     void enter( Context & a_context)
     {
-        volatile uint32_t i = 0U;
+        const auto owner = static_cast< uint32_t>(
+            internal::scheduler::getCurrentTaskId( internal::context::m_scheduler)
+        );
 
-        // Note: Function is constructed this way, because time between kernel lock/unlock and
-        //       waking from waitForSingleObject is big enough for context switches to occur
-        //       and modify m_lockCount even if m_event was set. So after waking up task,
-        //       m_lockCount test should be done again.
-        while ( true)
+        // Fast path: free or already owned critical section is taken without entering kernel.
+        if ( true == internal::critical_section::tryEnter( a_context, owner) ||
+             true == internal::critical_section::spinEnter( a_context, owner))
+        {
+            return;
+        }
+
+        // Waiter is registered before last test, so leave called after it either hands
+        // critical section over to waiting task, or sets the event, when task didn't start
+        // to wait yet. Spurious wake up (event left set) only results in another test.
+        internal::critical_section::addWaiter( a_context);
+
+        while ( false == internal::critical_section::tryEnter( a_context, owner))
         {
-            internal::lock::enter( internal::context::m_lock);
+            sync::WaitResult result = sync::waitForSingleObject( a_context.m_event);
+
+            if ( sync::WaitResult::ObjectSet != result)
             {
-                if ( 0U == a_context.m_lockCount)
-                {
-                    ++a_context.m_lockCount;
-                    internal::lock::leave( internal::context::m_lock);
-                    return;
-                }
+                // This is critical error since this function doesn't return a value.
+                // It would most likely happen when critical_section::init was not called.
+                error::print( "Critical Error!\n");
+                hardware::debug::setBreakpoint();
+                assert( true);
             }
-            internal::lock::leave( internal::context::m_lock);
-            
-            // Test critical state condition m_spinLock times, before creating any system object
-            // and context switching.
-            if ( i >= a_context.m_spinLock)
-            {
-                i = 0U;
-                sync::WaitResult result = sync::waitForSingleObject( a_context.m_event);
 
-                if ( sync::WaitResult::ObjectSet != result)
-                {
-                    // This is critical error since this function doesn't return a value.
-                    // It would most likely happen when critical_section::init was not called.
-                    error::print( "Critical Error!\n");
-                    hardware::debug::setBreakpoint();
-                    assert( true);
-                }
-            }
-            else
+            if ( true == internal::critical_section::isOwner( a_context, owner))
             {
-                ++i;
+                // Critical section was handed over by leave.
+                break;
             }
         }
+
+        internal::critical_section::removeWaiter( a_context);
     }
 
     void leave( Context & a_context)
     {
+        const auto current_task_id = internal::scheduler::getCurrentTaskId( internal::context::m_scheduler);
+
+        if ( false == internal::critical_section::isOwner( a_context, static_cast< uint32_t>( current_task_id)))
+        {
+            error::print( "Critical section is not owned by calling task!\n");
+            return;
+        }
+
+        // Kernel is called only when there is a task to wake up.
+        if ( false == internal::critical_section::leave( a_context))
+        {
+            return;
+        }
+
         internal::lock::enter( internal::context::m_lock);
         {
-            --a_context.m_lockCount;
-            if ( 0U == a_context.m_lockCount)
+            internal::task::Id waiting_task_id;
+
+            bool task_found = internal::scheduler::findWaitingTask(
+                internal::context::m_scheduler,
+                internal::context::m_tasks,
+                a_context.m_event,
+                waiting_task_id
+            );
+
+            if ( false == task_found)
             {
+                // Waiter is registered, but it didn't start to wait yet.
                 auto event_id = internal::handle::getId< internal::event::Id>( a_context.m_event);
-                internal::event::set( internal::context::m_events, event_id);
+                internal::event::set( internal::context::m_objects.m_events, event_id);
+            }
+            // Critical section could be taken by other task since it was released. Its
+            // leave will hand it over then.
+            else if ( true == internal::critical_section::tryLock( a_context, static_cast< uint32_t>( waiting_task_id)))
+            {
+                ( void) internal::scheduler::wakeWaitingTask(
+                    internal::context::m_scheduler,
+                    internal::context::m_tasks,
+                    waiting_task_id,
+                    sync::WaitResult::ObjectSet,
+                    0U
+                );
+
+                const auto current_task_priority = internal::task::priority::get( internal::context::m_tasks, current_task_id);
+                const auto waiting_task_priority = internal::task::priority::get( internal::context::m_tasks, waiting_task_id);
+
+                if ( waiting_task_priority < current_task_priority)
+                {
+                    internal::hardware::syscall( internal::hardware::SyscallId::ExecuteContextSwitch);
+                    return;
+                }
             }
         }
         internal::lock::leave( internal::context::m_lock);
@@ -766,8 +1021,8 @@ namespace kernel::static_queue
         kernel::Handle &        a_handle,
         size_t                  a_data_max_size,
         size_t                  a_data_type_size,
-        volatile void * const   ap_static_buffer,
-        const char * const      ap_name
+        void * const            ap_static_buffer,
+        const kernel::Name &    a_name
     )
     {
         if ( 0U == a_data_max_size)
@@ -791,12 +1046,12 @@ namespace kernel::static_queue
         kernel::internal::queue::Id created_queue_id;
 
         bool queue_created = kernel::internal::queue::create(
-            kernel::internal::context::m_queue,
+            kernel::internal::context::m_objects.m_queues,
             created_queue_id,
             a_data_max_size,
             a_data_type_size,
             ap_static_buffer,
-            ap_name
+            a_name.mp_string
         );
 
         if ( false == queue_created)
@@ -805,27 +1060,70 @@ namespace kernel::static_queue
             return false;
         }
 
+        kernel::Handle new_handle = internal::handle::create( internal::handle::ObjectType::Queue, created_queue_id);
+
+        if ( false == internal::registerName( new_handle, a_name))
+        {
+            internal::queue::destroy( internal::context::m_objects.m_queues, created_queue_id);
+            return false;
+        }
+
+        a_handle = new_handle;
+
         return true;
     }
 
-    bool open( kernel::Handle & a_handle, const char * const ap_name)
+    bool create(
+        kernel::Handle &        a_handle,
+        size_t                  a_data_max_size,
+        TypedIndexes &          a_typed_indexes,
+        const kernel::Name &    a_name
+    )
     {
-        if ( nullptr == ap_name)
+        if ( 0U == a_data_max_size)
         {
-            error::print( "Invalid argument! Empty pointer to queue name!\n");
+            error::print( "Invalid argument! Buffer size must be bigger than 0.\n");
             return false;
         }
 
-        internal::queue::Id queue_id;
+        internal::queue::Id created_queue_id;
 
-        bool queue_opened = internal::queue::open( internal::context::m_queue, queue_id, ap_name);
-        
-        if ( true == queue_opened)
+        bool queue_created = internal::queue::createTyped(
+            internal::context::m_objects.m_queues,
+            created_queue_id,
+            a_data_max_size,
+            a_typed_indexes,
+            a_name.mp_string
+        );
+
+        if ( false == queue_created)
+        {
+            error::print( "Failed to internally create static queue!\n");
+            return false;
+        }
+
+        kernel::Handle new_handle = internal::handle::create( internal::handle::ObjectType::Queue, created_queue_id);
+
+        if ( false == internal::registerName( new_handle, a_name))
+        {
+            internal::queue::destroy( internal::context::m_objects.m_queues, created_queue_id);
+            return false;
+        }
+
+        a_handle = new_handle;
+
+        return true;
+    }
+
+    bool open( kernel::Handle & a_handle, const kernel::Name & a_name)
+    {
+        if ( nullptr == a_name.mp_string)
         {
-            a_handle = internal::handle::create( internal::handle::ObjectType::Queue, queue_id);
+            error::print( "Invalid argument! Empty pointer to queue name!\n");
+            return false;
         }
 
-        return queue_opened;
+        return internal::openByName( a_handle, a_name, internal::handle::ObjectType::Queue);
     }
 
     void destroy( kernel::Handle & a_handle)
@@ -840,10 +1138,12 @@ namespace kernel::static_queue
 
         auto queue_id = internal::handle::getId< internal::queue::Id>( a_handle);
 
-        internal::queue::destroy( internal::context::m_queue, queue_id);
+        internal::unregisterName( internal::queue::getName( internal::context::m_objects.m_queues, queue_id));
+        internal::leaveQueueSet( a_handle);
+        internal::queue::destroy( internal::context::m_objects.m_queues, queue_id);
     }
 
-    bool send( kernel::Handle & a_handle, volatile void * const ap_data)
+    bool send( kernel::Handle & a_handle, const void * const ap_data)
     {
         const auto object_type = internal::handle::getObjectType( a_handle);
 
@@ -861,16 +1161,34 @@ namespace kernel::static_queue
 
         auto queue_id = internal::handle::getId< internal::queue::Id>( a_handle);
 
+        // Set to receiver Task handle only on direct handoff.
+        kernel::Handle woken_receiver = a_handle;
+
         bool send_result = internal::queue::send(
-            internal::context::m_queue,
+            internal::context::m_objects.m_queues,
             queue_id,
-            ap_data
+            ap_data,
+            &woken_receiver
         );
 
+        if ( internal::handle::ObjectType::Task == internal::handle::getObjectType( woken_receiver))
+        {
+            internal::wakeQueueReceiver( woken_receiver);
+        }
+        else if ( true == send_result)
+        {
+            internal::notifyQueueSet( a_handle);
+        }
+
+        if ( true == send_result)
+        {
+            internal::requestReschedule();
+        }
+
         return send_result;
     }
 
-    bool receive( kernel::Handle & a_handle, volatile void * const ap_data)
+    bool receive( kernel::Handle & a_handle, void * const ap_data)
     {
         const auto object_type = internal::handle::getObjectType( a_handle);
 
@@ -889,15 +1207,21 @@ namespace kernel::static_queue
         auto queue_id = internal::handle::getId< internal::queue::Id>( a_handle);
 
         bool receive_result = internal::queue::receive(
-            internal::context::m_queue,
+            internal::context::m_objects.m_queues,
             queue_id,
             ap_data
         );
 
+        // Sender could wait for free space.
+        if ( true == receive_result)
+        {
+            internal::requestReschedule();
+        }
+
         return receive_result;
     }
 
-    bool size( kernel::Handle & a_handle, size_t & a_size)
+    bool sendToFront( kernel::Handle & a_handle, const void * const ap_data)
     {
         const auto object_type = internal::handle::getObjectType( a_handle);
 
@@ -907,78 +1231,2446 @@ namespace kernel::static_queue
             return false;
         }
 
+        if ( nullptr == ap_data)
+        {
+            error::print( "Invalid argument! Empty pointer to data!\n");
+            return false;
+        }
+
         auto queue_id = internal::handle::getId< internal::queue::Id>( a_handle);
-            
-        a_size = internal::queue::getSize( internal::context::m_queue, queue_id);
 
-        return true;
-    }
+        // Set to receiver Task handle only on direct handoff.
+        kernel::Handle woken_receiver = a_handle;
 
-    bool isFull( kernel::Handle & a_handle, bool & a_is_full)
-    {
-        const auto object_type = internal::handle::getObjectType( a_handle);
+        bool send_result = internal::queue::sendToFront(
+            internal::context::m_objects.m_queues,
+            queue_id,
+            ap_data,
+            &woken_receiver
+        );
 
-        if ( internal::handle::ObjectType::Queue != object_type)
+        if ( internal::handle::ObjectType::Task == internal::handle::getObjectType( woken_receiver))
         {
-            error::print( "Invalid handle! Underlying object type is not supported by this function.\n");
-            return false;
+            internal::wakeQueueReceiver( woken_receiver);
+        }
+        else if ( true == send_result)
+        {
+            internal::notifyQueueSet( a_handle);
         }
 
-        auto queue_id = internal::handle::getId< internal::queue::Id>( a_handle);
-            
-        a_is_full = internal::queue::isFull( internal::context::m_queue, queue_id);
+        if ( true == send_result)
+        {
+            internal::requestReschedule();
+        }
 
-        return true;
+        return send_result;
     }
 
-    bool isEmpty( kernel::Handle & a_handle, bool & a_is_empty)
+    size_t sendN( kernel::Handle & a_handle, const void * const ap_data, size_t a_number_of_elements)
     {
         const auto object_type = internal::handle::getObjectType( a_handle);
 
         if ( internal::handle::ObjectType::Queue != object_type)
         {
             error::print( "Invalid handle! Underlying object type is not supported by this function.\n");
-            return false;
+            return 0U;
         }
 
-        auto queue_id = internal::handle::getId< internal::queue::Id>( a_handle);
-            
-        a_is_empty = internal::queue::isEmpty( internal::context::m_queue, queue_id);
-
-        return true;
+        if ( nullptr == ap_data)
+        {
+            error::print( "Invalid argument! Empty pointer to data!\n");
+            return 0U;
+        }
+
+        auto queue_id = internal::handle::getId< internal::queue::Id>( a_handle);
+
+        const size_t elements_sent = internal::queue::sendN(
+            internal::context::m_objects.m_queues,
+            queue_id,
+            ap_data,
+            a_number_of_elements
+        );
+
+        if ( elements_sent > 0U)
+        {
+            internal::notifyQueueSet( a_handle);
+            internal::requestReschedule();
+        }
+
+        return elements_sent;
+    }
+
+    size_t receiveN( kernel::Handle & a_handle, void * const ap_data, size_t a_number_of_elements)
+    {
+        const auto object_type = internal::handle::getObjectType( a_handle);
+
+        if ( internal::handle::ObjectType::Queue != object_type)
+        {
+            error::print( "Invalid handle! Underlying object type is not supported by this function.\n");
+            return 0U;
+        }
+
+        if ( nullptr == ap_data)
+        {
+            error::print( "Invalid argument! Empty pointer to data!\n");
+            return 0U;
+        }
+
+        auto queue_id = internal::handle::getId< internal::queue::Id>( a_handle);
+
+        const size_t elements_received = internal::queue::receiveN(
+            internal::context::m_objects.m_queues,
+            queue_id,
+            ap_data,
+            a_number_of_elements
+        );
+
+        if ( elements_received > 0U)
+        {
+            internal::requestReschedule();
+        }
+
+        return elements_received;
+    }
+
+    void * reserve( kernel::Handle & a_handle, size_t & a_number_of_elements)
+    {
+        const auto object_type = internal::handle::getObjectType( a_handle);
+
+        if ( internal::handle::ObjectType::Queue != object_type)
+        {
+            error::print( "Invalid handle! Underlying object type is not supported by this function.\n");
+            a_number_of_elements = 0U;
+            return nullptr;
+        }
+
+        auto queue_id = internal::handle::getId< internal::queue::Id>( a_handle);
+
+        return internal::queue::reserve(
+            internal::context::m_objects.m_queues,
+            queue_id,
+            a_number_of_elements
+        );
+    }
+
+    bool commit( kernel::Handle & a_handle, size_t a_number_of_elements)
+    {
+        const auto object_type = internal::handle::getObjectType( a_handle);
+
+        if ( internal::handle::ObjectType::Queue != object_type)
+        {
+            error::print( "Invalid handle! Underlying object type is not supported by this function.\n");
+            return false;
+        }
+
+        auto queue_id = internal::handle::getId< internal::queue::Id>( a_handle);
+
+        const bool commit_result = internal::queue::commit(
+            internal::context::m_objects.m_queues,
+            queue_id,
+            a_number_of_elements
+        );
+
+        if ( ( true == commit_result) && ( a_number_of_elements > 0U))
+        {
+            internal::notifyQueueSet( a_handle);
+            internal::requestReschedule();
+        }
+
+        return commit_result;
+    }
+
+    const void * peek( kernel::Handle & a_handle, size_t & a_number_of_elements)
+    {
+        const auto object_type = internal::handle::getObjectType( a_handle);
+
+        if ( internal::handle::ObjectType::Queue != object_type)
+        {
+            error::print( "Invalid handle! Underlying object type is not supported by this function.\n");
+            a_number_of_elements = 0U;
+            return nullptr;
+        }
+
+        auto queue_id = internal::handle::getId< internal::queue::Id>( a_handle);
+
+        return internal::queue::peek(
+            internal::context::m_objects.m_queues,
+            queue_id,
+            a_number_of_elements
+        );
+    }
+
+    bool consume( kernel::Handle & a_handle, size_t a_number_of_elements)
+    {
+        const auto object_type = internal::handle::getObjectType( a_handle);
+
+        if ( internal::handle::ObjectType::Queue != object_type)
+        {
+            error::print( "Invalid handle! Underlying object type is not supported by this function.\n");
+            return false;
+        }
+
+        auto queue_id = internal::handle::getId< internal::queue::Id>( a_handle);
+
+        return internal::queue::consume(
+            internal::context::m_objects.m_queues,
+            queue_id,
+            a_number_of_elements
+        );
+    }
+
+    sync::WaitResult waitForNotFull( kernel::Handle & a_handle, bool a_wait_forever, TimeMs a_timeout)
+    {
+        const auto object_type = internal::handle::getObjectType( a_handle);
+
+        if ( internal::handle::ObjectType::Queue != object_type)
+        {
+            error::print( "Invalid handle! Underlying object type is not supported by this function.\n");
+            return sync::WaitResult::WaitFailed;
+        }
+
+        auto queue_id = internal::handle::getId< internal::queue::Id>( a_handle);
+
+        kernel::Handle not_full_condition = internal::handle::create(
+            internal::handle::ObjectType::QueueNotFull,
+            queue_id
+        );
+
+        return sync::waitForSingleObject( not_full_condition, a_wait_forever, a_timeout);
+    }
+
+    void notifyTypedChange()
+    {
+        internal::requestReschedule();
+    }
+
+    bool setTriggerLevel( kernel::Handle & a_handle, size_t a_trigger_level)
+    {
+        return internal::setQueueTriggerLevel( a_handle, a_trigger_level, false, 0U);
+    }
+
+    bool setTriggerLevel( kernel::Handle & a_handle, size_t a_trigger_level, TimeMs a_batch_timeout)
+    {
+        return internal::setQueueTriggerLevel( a_handle, a_trigger_level, true, a_batch_timeout);
+    }
+
+    bool getStats( kernel::Handle & a_handle, Stats & a_stats)
+    {
+        if constexpr ( false == internal::queue::stats_enable)
+        {
+            error::print( "Queue statistics are disabled! Set KERNEL_QUEUE_STATS_ENABLE.\n");
+            return false;
+        }
+
+        const auto object_type = internal::handle::getObjectType( a_handle);
+
+        if ( internal::handle::ObjectType::Queue != object_type)
+        {
+            error::print( "Invalid handle! Underlying object type is not supported by this function.\n");
+            return false;
+        }
+
+        auto queue_id = internal::handle::getId< internal::queue::Id>( a_handle);
+
+        if ( true == internal::queue::isTyped( internal::context::m_objects.m_queues, queue_id))
+        {
+            return false;
+        }
+
+        internal::queue::getStats( internal::context::m_objects.m_queues, queue_id, a_stats);
+
+        return true;
+    }
+
+    bool resetStats( kernel::Handle & a_handle)
+    {
+        if constexpr ( false == internal::queue::stats_enable)
+        {
+            error::print( "Queue statistics are disabled! Set KERNEL_QUEUE_STATS_ENABLE.\n");
+            return false;
+        }
+
+        const auto object_type = internal::handle::getObjectType( a_handle);
+
+        if ( internal::handle::ObjectType::Queue != object_type)
+        {
+            error::print( "Invalid handle! Underlying object type is not supported by this function.\n");
+            return false;
+        }
+
+        auto queue_id = internal::handle::getId< internal::queue::Id>( a_handle);
+
+        internal::queue::resetStats( internal::context::m_objects.m_queues, queue_id);
+
+        return true;
+    }
+
+    // Note: Queue can be filled by another sender between wake up and send,
+    //       so send is retried until timeout elapse.
+    bool send( kernel::Handle & a_handle, const void * const ap_data, bool a_wait_forever, TimeMs a_timeout)
+    {
+        const auto object_type = internal::handle::getObjectType( a_handle);
+
+        if ( internal::handle::ObjectType::Queue != object_type)
+        {
+            error::print( "Invalid handle! Underlying object type is not supported by this function.\n");
+            return false;
+        }
+
+        if ( nullptr == ap_data)
+        {
+            error::print( "Invalid argument! Empty pointer to data!\n");
+            return false;
+        }
+
+        auto queue_id = internal::handle::getId< internal::queue::Id>( a_handle);
+
+        const TimeMs start_time = getTime();
+
+        // Set to receiver Task handle only on direct handoff.
+        kernel::Handle woken_receiver = a_handle;
+
+        // Send is counted as dropped only when it times out.
+        while ( false == internal::queue::send( internal::context::m_objects.m_queues, queue_id, ap_data, &woken_receiver, false))
+        {
+            const TimeMs elapsed_time = getTime() - start_time;
+
+            bool timeout_elapsed = ( false == a_wait_forever) && ( elapsed_time >= a_timeout);
+
+            if ( false == timeout_elapsed)
+            {
+                const TimeMs remaining_time = ( true == a_wait_forever) ? 0U : a_timeout - elapsed_time;
+
+                timeout_elapsed = ( sync::WaitResult::ObjectSet != waitForNotFull( a_handle, a_wait_forever, remaining_time));
+            }
+
+            if ( true == timeout_elapsed)
+            {
+                internal::queue::countDroppedSend( internal::context::m_objects.m_queues, queue_id);
+                return false;
+            }
+        }
+
+        if ( internal::handle::ObjectType::Task == internal::handle::getObjectType( woken_receiver))
+        {
+            internal::wakeQueueReceiver( woken_receiver);
+        }
+        else
+        {
+            internal::notifyQueueSet( a_handle);
+        }
+
+        return true;
+    }
+
+    // Note: While waiting, task is registered as the queue receiver, so sender can copy item
+    //       straight into ap_data. Queue can be emptied by another receiver between wake up
+    //       and receive, so receive is retried until timeout elapse.
+    bool receive( kernel::Handle & a_handle, void * const ap_data, bool a_wait_forever, TimeMs a_timeout)
+    {
+        const auto object_type = internal::handle::getObjectType( a_handle);
+
+        if ( internal::handle::ObjectType::Queue != object_type)
+        {
+            error::print( "Invalid handle! Underlying object type is not supported by this function.\n");
+            return false;
+        }
+
+        if ( nullptr == ap_data)
+        {
+            error::print( "Invalid argument! Empty pointer to data!\n");
+            return false;
+        }
+
+        auto queue_id = internal::handle::getId< internal::queue::Id>( a_handle);
+
+        const TimeMs start_time = getTime();
+
+        const kernel::Handle receiver = task::getCurrent();
+
+        while ( false == internal::queue::receiveOrRegister( internal::context::m_objects.m_queues, queue_id, ap_data, receiver))
+        {
+            const TimeMs elapsed_time = getTime() - start_time;
+
+            bool timeout_elapsed = ( false == a_wait_forever) && ( elapsed_time >= a_timeout);
+
+            if ( false == timeout_elapsed)
+            {
+                const TimeMs remaining_time = ( true == a_wait_forever) ? 0U : a_timeout - elapsed_time;
+
+                // Registered receiver waits for its own condition, other receivers for the queue.
+                kernel::Handle wait_handle = a_handle;
+
+                if ( true == internal::queue::isRegisteredReceiver( internal::context::m_objects.m_queues, queue_id, receiver))
+                {
+                    wait_handle = internal::handle::create( internal::handle::ObjectType::QueueReceiver, queue_id);
+                }
+
+                timeout_elapsed = ( sync::WaitResult::ObjectSet != sync::waitForSingleObject( wait_handle, a_wait_forever, remaining_time));
+            }
+
+            // Item could have been handed off, even if wait timed out.
+            if ( true == internal::queue::unregisterReceiver( internal::context::m_objects.m_queues, queue_id, receiver))
+            {
+                return true;
+            }
+
+            if ( true == timeout_elapsed)
+            {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    bool size( kernel::Handle & a_handle, size_t & a_size)
+    {
+        const auto object_type = internal::handle::getObjectType( a_handle);
+
+        if ( internal::handle::ObjectType::Queue != object_type)
+        {
+            error::print( "Invalid handle! Underlying object type is not supported by this function.\n");
+            return false;
+        }
+
+        auto queue_id = internal::handle::getId< internal::queue::Id>( a_handle);
+            
+        a_size = internal::queue::getSize( internal::context::m_objects.m_queues, queue_id);
+
+        return true;
+    }
+
+    bool isFull( kernel::Handle & a_handle, bool & a_is_full)
+    {
+        const auto object_type = internal::handle::getObjectType( a_handle);
+
+        if ( internal::handle::ObjectType::Queue != object_type)
+        {
+            error::print( "Invalid handle! Underlying object type is not supported by this function.\n");
+            return false;
+        }
+
+        auto queue_id = internal::handle::getId< internal::queue::Id>( a_handle);
+            
+        a_is_full = internal::queue::isFull( internal::context::m_objects.m_queues, queue_id);
+
+        return true;
+    }
+
+    bool isEmpty( kernel::Handle & a_handle, bool & a_is_empty)
+    {
+        const auto object_type = internal::handle::getObjectType( a_handle);
+
+        if ( internal::handle::ObjectType::Queue != object_type)
+        {
+            error::print( "Invalid handle! Underlying object type is not supported by this function.\n");
+            return false;
+        }
+
+        auto queue_id = internal::handle::getId< internal::queue::Id>( a_handle);
+            
+        a_is_empty = internal::queue::isEmpty( internal::context::m_objects.m_queues, queue_id);
+
+        return true;
+    }
+}
+
+namespace kernel::ring_buffer
+{
+    bool create(
+        kernel::Handle &        a_handle,
+        size_t                  a_data_max_size,
+        size_t                  a_data_type_size,
+        void * const            ap_static_buffer
+    )
+    {
+        if ( false == internal::ring_buffer::isPowerOfTwo( a_data_max_size))
+        {
+            error::print( "Invalid argument! Buffer size must be a power of two.\n");
+            return false;
+        }
+
+        if ( 0U == a_data_type_size)
+        {
+            error::print( "Invalid argument! Type size must be bigger than 0.\n");
+            return false;
+        }
+
+        if ( nullptr == ap_static_buffer)
+        {
+            error::print( "Invalid argument! Empty pointer to static buffer!\n");
+            return false;
+        }
+
+        internal::lock::enter( internal::context::m_lock);
+        {
+            internal::ring_buffer::Id created_ring_buffer_id;
+
+            bool ring_buffer_created = internal::ring_buffer::create(
+                internal::context::m_objects.m_ring_buffers,
+                created_ring_buffer_id,
+                a_data_max_size,
+                a_data_type_size,
+                ap_static_buffer
+            );
+
+            if ( false == ring_buffer_created)
+            {
+                error::print( "Failed to internally create ring buffer!\n");
+                internal::lock::leave( internal::context::m_lock);
+                return false;
+            }
+
+            a_handle = internal::handle::create( internal::handle::ObjectType::RingBuffer, created_ring_buffer_id);
+        }
+        internal::lock::leave( internal::context::m_lock);
+
+        return true;
+    }
+
+    void destroy( kernel::Handle & a_handle)
+    {
+        const auto object_type = internal::handle::getObjectType( a_handle);
+
+        if ( internal::handle::ObjectType::RingBuffer != object_type)
+        {
+            error::print( "Invalid handle! Underlying object type is not supported by this function.\n");
+            return;
+        }
+
+        internal::lock::enter( internal::context::m_lock);
+        {
+            auto ring_buffer_id = internal::handle::getId< internal::ring_buffer::Id>( a_handle);
+            internal::ring_buffer::destroy( internal::context::m_objects.m_ring_buffers, ring_buffer_id);
+        }
+        internal::lock::leave( internal::context::m_lock);
+    }
+
+    // Note: No lock is used on purpose. Producer and consumer only synchronize with memory barriers.
+    bool send( kernel::Handle & a_handle, const void * const ap_data)
+    {
+        const auto object_type = internal::handle::getObjectType( a_handle);
+
+        if ( internal::handle::ObjectType::RingBuffer != object_type)
+        {
+            error::print( "Invalid handle! Underlying object type is not supported by this function.\n");
+            return false;
+        }
+
+        if ( nullptr == ap_data)
+        {
+            error::print( "Invalid argument! Empty pointer to data!\n");
+            return false;
+        }
+
+        auto ring_buffer_id = internal::handle::getId< internal::ring_buffer::Id>( a_handle);
+
+        bool send_result = internal::ring_buffer::send(
+            internal::context::m_objects.m_ring_buffers,
+            ring_buffer_id,
+            ap_data
+        );
+
+        if ( true == send_result)
+        {
+            internal::requestReschedule();
+        }
+
+        return send_result;
+    }
+
+    bool receive( kernel::Handle & a_handle, void * const ap_data)
+    {
+        const auto object_type = internal::handle::getObjectType( a_handle);
+
+        if ( internal::handle::ObjectType::RingBuffer != object_type)
+        {
+            error::print( "Invalid handle! Underlying object type is not supported by this function.\n");
+            return false;
+        }
+
+        if ( nullptr == ap_data)
+        {
+            error::print( "Invalid argument! Empty pointer to data!\n");
+            return false;
+        }
+
+        auto ring_buffer_id = internal::handle::getId< internal::ring_buffer::Id>( a_handle);
+
+        bool receive_result = internal::ring_buffer::receive(
+            internal::context::m_objects.m_ring_buffers,
+            ring_buffer_id,
+            ap_data
+        );
+
+        return receive_result;
+    }
+
+    bool size( kernel::Handle & a_handle, size_t & a_size)
+    {
+        const auto object_type = internal::handle::getObjectType( a_handle);
+
+        if ( internal::handle::ObjectType::RingBuffer != object_type)
+        {
+            error::print( "Invalid handle! Underlying object type is not supported by this function.\n");
+            return false;
+        }
+
+        auto ring_buffer_id = internal::handle::getId< internal::ring_buffer::Id>( a_handle);
+
+        a_size = internal::ring_buffer::getSize( internal::context::m_objects.m_ring_buffers, ring_buffer_id);
+
+        return true;
+    }
+}
+
+namespace kernel::mpsc_queue
+{
+    bool create(
+        kernel::Handle &            a_handle,
+        size_t                      a_data_max_size,
+        size_t                      a_data_type_size,
+        void * const                ap_static_buffer,
+        volatile uint32_t * const   ap_sequences
+    )
+    {
+        if ( false == internal::mpsc_queue::isPowerOfTwo( a_data_max_size))
+        {
+            error::print( "Invalid argument! Buffer size must be a power of two.\n");
+            return false;
+        }
+
+        if ( 0U == a_data_type_size)
+        {
+            error::print( "Invalid argument! Type size must be bigger than 0.\n");
+            return false;
+        }
+
+        if ( nullptr == ap_static_buffer)
+        {
+            error::print( "Invalid argument! Empty pointer to static buffer!\n");
+            return false;
+        }
+
+        if ( nullptr == ap_sequences)
+        {
+            error::print( "Invalid argument! Empty pointer to sequences buffer!\n");
+            return false;
+        }
+
+        internal::lock::enter( internal::context::m_lock);
+        {
+            internal::mpsc_queue::Id created_mpsc_queue_id;
+
+            bool mpsc_queue_created = internal::mpsc_queue::create(
+                internal::context::m_objects.m_mpsc_queues,
+                created_mpsc_queue_id,
+                a_data_max_size,
+                a_data_type_size,
+                ap_static_buffer,
+                ap_sequences
+            );
+
+            if ( false == mpsc_queue_created)
+            {
+                error::print( "Failed to internally create MPSC queue!\n");
+                internal::lock::leave( internal::context::m_lock);
+                return false;
+            }
+
+            a_handle = internal::handle::create( internal::handle::ObjectType::MpscQueue, created_mpsc_queue_id);
+        }
+        internal::lock::leave( internal::context::m_lock);
+
+        return true;
+    }
+
+    void destroy( kernel::Handle & a_handle)
+    {
+        const auto object_type = internal::handle::getObjectType( a_handle);
+
+        if ( internal::handle::ObjectType::MpscQueue != object_type)
+        {
+            error::print( "Invalid handle! Underlying object type is not supported by this function.\n");
+            return;
+        }
+
+        internal::lock::enter( internal::context::m_lock);
+        {
+            auto mpsc_queue_id = internal::handle::getId< internal::mpsc_queue::Id>( a_handle);
+            internal::mpsc_queue::destroy( internal::context::m_objects.m_mpsc_queues, mpsc_queue_id);
+        }
+        internal::lock::leave( internal::context::m_lock);
+    }
+
+    // Note: No lock is used on purpose. Producers claim slots with compare and swap.
+    bool send( kernel::Handle & a_handle, const void * const ap_data)
+    {
+        const auto object_type = internal::handle::getObjectType( a_handle);
+
+        if ( internal::handle::ObjectType::MpscQueue != object_type)
+        {
+            error::print( "Invalid handle! Underlying object type is not supported by this function.\n");
+            return false;
+        }
+
+        if ( nullptr == ap_data)
+        {
+            error::print( "Invalid argument! Empty pointer to data!\n");
+            return false;
+        }
+
+        auto mpsc_queue_id = internal::handle::getId< internal::mpsc_queue::Id>( a_handle);
+
+        bool send_result = internal::mpsc_queue::send(
+            internal::context::m_objects.m_mpsc_queues,
+            mpsc_queue_id,
+            ap_data
+        );
+
+        if ( true == send_result)
+        {
+            internal::requestReschedule();
+        }
+
+        return send_result;
+    }
+
+    bool receive( kernel::Handle & a_handle, void * const ap_data)
+    {
+        const auto object_type = internal::handle::getObjectType( a_handle);
+
+        if ( internal::handle::ObjectType::MpscQueue != object_type)
+        {
+            error::print( "Invalid handle! Underlying object type is not supported by this function.\n");
+            return false;
+        }
+
+        if ( nullptr == ap_data)
+        {
+            error::print( "Invalid argument! Empty pointer to data!\n");
+            return false;
+        }
+
+        auto mpsc_queue_id = internal::handle::getId< internal::mpsc_queue::Id>( a_handle);
+
+        bool receive_result = internal::mpsc_queue::receive(
+            internal::context::m_objects.m_mpsc_queues,
+            mpsc_queue_id,
+            ap_data
+        );
+
+        return receive_result;
+    }
+
+    bool size( kernel::Handle & a_handle, size_t & a_size)
+    {
+        const auto object_type = internal::handle::getObjectType( a_handle);
+
+        if ( internal::handle::ObjectType::MpscQueue != object_type)
+        {
+            error::print( "Invalid handle! Underlying object type is not supported by this function.\n");
+            return false;
+        }
+
+        auto mpsc_queue_id = internal::handle::getId< internal::mpsc_queue::Id>( a_handle);
+
+        a_size = internal::mpsc_queue::getSize( internal::context::m_objects.m_mpsc_queues, mpsc_queue_id);
+
+        return true;
+    }
+}
+
+namespace kernel::priority_queue
+{
+    bool create(
+        kernel::Handle &        a_handle,
+        size_t                  a_data_max_size,
+        size_t                  a_data_type_size,
+        void * const            ap_static_buffer,
+        Entry * const           ap_entries
+    )
+    {
+        if ( ( 0U == a_data_max_size) || ( a_data_max_size > 0x1'0000U))
+        {
+            error::print( "Invalid argument! Buffer size must be in range from 1 to 65536.\n");
+            return false;
+        }
+
+        if ( 0U == a_data_type_size)
+        {
+            error::print( "Invalid argument! Type size must be bigger than 0.\n");
+            return false;
+        }
+
+        if ( ( nullptr == ap_static_buffer) || ( nullptr == ap_entries))
+        {
+            error::print( "Invalid argument! Empty pointer to static buffer!\n");
+            return false;
+        }
+
+        internal::lock::enter( internal::context::m_lock);
+        {
+            internal::priority_queue::Id created_queue_id;
+
+            bool queue_created = internal::priority_queue::create(
+                internal::context::m_objects.m_priority_queues,
+                created_queue_id,
+                a_data_max_size,
+                a_data_type_size,
+                ap_static_buffer,
+                ap_entries
+            );
+
+            if ( false == queue_created)
+            {
+                error::print( "Failed to internally create priority queue!\n");
+                internal::lock::leave( internal::context::m_lock);
+                return false;
+            }
+
+            a_handle = internal::handle::create( internal::handle::ObjectType::PriorityQueue, created_queue_id);
+        }
+        internal::lock::leave( internal::context::m_lock);
+
+        return true;
+    }
+
+    void destroy( kernel::Handle & a_handle)
+    {
+        const auto object_type = internal::handle::getObjectType( a_handle);
+
+        if ( internal::handle::ObjectType::PriorityQueue != object_type)
+        {
+            error::print( "Invalid handle! Underlying object type is not supported by this function.\n");
+            return;
+        }
+
+        internal::lock::enter( internal::context::m_lock);
+        {
+            auto queue_id = internal::handle::getId< internal::priority_queue::Id>( a_handle);
+            internal::priority_queue::destroy( internal::context::m_objects.m_priority_queues, queue_id);
+        }
+        internal::lock::leave( internal::context::m_lock);
+    }
+
+    bool send( kernel::Handle & a_handle, const void * const ap_data, Priority a_priority)
+    {
+        const auto object_type = internal::handle::getObjectType( a_handle);
+
+        if ( internal::handle::ObjectType::PriorityQueue != object_type)
+        {
+            error::print( "Invalid handle! Underlying object type is not supported by this function.\n");
+            return false;
+        }
+
+        if ( nullptr == ap_data)
+        {
+            error::print( "Invalid argument! Empty pointer to data!\n");
+            return false;
+        }
+
+        auto queue_id = internal::handle::getId< internal::priority_queue::Id>( a_handle);
+
+        bool send_result = internal::priority_queue::send(
+            internal::context::m_objects.m_priority_queues,
+            queue_id,
+            ap_data,
+            a_priority
+        );
+
+        if ( true == send_result)
+        {
+            internal::requestReschedule();
+        }
+
+        return send_result;
+    }
+
+    bool sendToFront( kernel::Handle & a_handle, const void * const ap_data)
+    {
+        const auto object_type = internal::handle::getObjectType( a_handle);
+
+        if ( internal::handle::ObjectType::PriorityQueue != object_type)
+        {
+            error::print( "Invalid handle! Underlying object type is not supported by this function.\n");
+            return false;
+        }
+
+        if ( nullptr == ap_data)
+        {
+            error::print( "Invalid argument! Empty pointer to data!\n");
+            return false;
+        }
+
+        auto queue_id = internal::handle::getId< internal::priority_queue::Id>( a_handle);
+
+        bool send_result = internal::priority_queue::sendToFront(
+            internal::context::m_objects.m_priority_queues,
+            queue_id,
+            ap_data
+        );
+
+        if ( true == send_result)
+        {
+            internal::requestReschedule();
+        }
+
+        return send_result;
+    }
+
+    bool receive( kernel::Handle & a_handle, void * const ap_data, Priority * const ap_priority)
+    {
+        const auto object_type = internal::handle::getObjectType( a_handle);
+
+        if ( internal::handle::ObjectType::PriorityQueue != object_type)
+        {
+            error::print( "Invalid handle! Underlying object type is not supported by this function.\n");
+            return false;
+        }
+
+        if ( nullptr == ap_data)
+        {
+            error::print( "Invalid argument! Empty pointer to data!\n");
+            return false;
+        }
+
+        auto queue_id = internal::handle::getId< internal::priority_queue::Id>( a_handle);
+
+        bool receive_result = internal::priority_queue::receive(
+            internal::context::m_objects.m_priority_queues,
+            queue_id,
+            ap_data,
+            ap_priority
+        );
+
+        return receive_result;
+    }
+
+    bool size( kernel::Handle & a_handle, size_t & a_size)
+    {
+        const auto object_type = internal::handle::getObjectType( a_handle);
+
+        if ( internal::handle::ObjectType::PriorityQueue != object_type)
+        {
+            error::print( "Invalid handle! Underlying object type is not supported by this function.\n");
+            return false;
+        }
+
+        auto queue_id = internal::handle::getId< internal::priority_queue::Id>( a_handle);
+
+        a_size = internal::priority_queue::getSize( internal::context::m_objects.m_priority_queues, queue_id);
+
+        return true;
+    }
+}
+
+namespace kernel::stream_buffer
+{
+    bool create(
+        kernel::Handle &        a_handle,
+        size_t                  a_data_max_size,
+        void * const            ap_static_buffer,
+        size_t                  a_trigger_level
+    )
+    {
+        return internal::createStreamBuffer(
+            a_handle,
+            internal::handle::ObjectType::StreamBuffer,
+            a_data_max_size,
+            ap_static_buffer,
+            a_trigger_level
+        );
+    }
+
+    void destroy( kernel::Handle & a_handle)
+    {
+        internal::destroyStreamBuffer( a_handle, internal::handle::ObjectType::StreamBuffer);
+    }
+
+    size_t send( kernel::Handle & a_handle, const void * const ap_data, size_t a_number_of_bytes)
+    {
+        const auto object_type = internal::handle::getObjectType( a_handle);
+
+        if ( internal::handle::ObjectType::StreamBuffer != object_type)
+        {
+            error::print( "Invalid handle! Underlying object type is not supported by this function.\n");
+            return 0U;
+        }
+
+        if ( nullptr == ap_data)
+        {
+            error::print( "Invalid argument! Empty pointer to data!\n");
+            return 0U;
+        }
+
+        auto stream_buffer_id = internal::handle::getId< internal::stream_buffer::Id>( a_handle);
+
+        const size_t bytes_sent = internal::stream_buffer::send(
+            internal::context::m_objects.m_stream_buffers,
+            stream_buffer_id,
+            ap_data,
+            a_number_of_bytes
+        );
+
+        if ( bytes_sent > 0U)
+        {
+            internal::requestReschedule();
+        }
+
+        return bytes_sent;
+    }
+
+    size_t receive( kernel::Handle & a_handle, void * const ap_data, size_t a_number_of_bytes)
+    {
+        const auto object_type = internal::handle::getObjectType( a_handle);
+
+        if ( internal::handle::ObjectType::StreamBuffer != object_type)
+        {
+            error::print( "Invalid handle! Underlying object type is not supported by this function.\n");
+            return 0U;
+        }
+
+        if ( nullptr == ap_data)
+        {
+            error::print( "Invalid argument! Empty pointer to data!\n");
+            return 0U;
+        }
+
+        auto stream_buffer_id = internal::handle::getId< internal::stream_buffer::Id>( a_handle);
+
+        const size_t bytes_received = internal::stream_buffer::receive(
+            internal::context::m_objects.m_stream_buffers,
+            stream_buffer_id,
+            ap_data,
+            a_number_of_bytes
+        );
+
+        // Writer could wait for free space.
+        if ( bytes_received > 0U)
+        {
+            internal::requestReschedule();
+        }
+
+        return bytes_received;
+    }
+
+    // Note: Bytes are sent in chunks as space is freed, so reader can drain buffer meanwhile.
+    size_t send(
+        kernel::Handle &    a_handle,
+        const void * const  ap_data,
+        size_t              a_number_of_bytes,
+        bool                a_wait_forever,
+        TimeMs              a_timeout
+    )
+    {
+        const auto object_type = internal::handle::getObjectType( a_handle);
+
+        if ( internal::handle::ObjectType::StreamBuffer != object_type)
+        {
+            error::print( "Invalid handle! Underlying object type is not supported by this function.\n");
+            return 0U;
+        }
+
+        if ( nullptr == ap_data)
+        {
+            error::print( "Invalid argument! Empty pointer to data!\n");
+            return 0U;
+        }
+
+        auto stream_buffer_id = internal::handle::getId< internal::stream_buffer::Id>( a_handle);
+
+        const TimeMs start_time = getTime();
+
+        const uint8_t * const p_bytes = reinterpret_cast< const uint8_t *>( ap_data);
+        size_t bytes_sent = 0U;
+
+        while ( bytes_sent < a_number_of_bytes)
+        {
+            bytes_sent += internal::stream_buffer::send(
+                internal::context::m_objects.m_stream_buffers,
+                stream_buffer_id,
+                p_bytes + bytes_sent,
+                a_number_of_bytes - bytes_sent
+            );
+
+            if ( bytes_sent == a_number_of_bytes)
+            {
+                break;
+            }
+
+            const TimeMs elapsed_time = getTime() - start_time;
+
+            if ( ( false == a_wait_forever) && ( elapsed_time >= a_timeout))
+            {
+                break;
+            }
+
+            const TimeMs remaining_time = ( true == a_wait_forever) ? 0U : a_timeout - elapsed_time;
+
+            if ( sync::WaitResult::ObjectSet != waitForNotFull( a_handle, a_wait_forever, remaining_time))
+            {
+                break;
+            }
+        }
+
+        return bytes_sent;
+    }
+
+    kernel::sync::WaitResult waitForNotFull( kernel::Handle & a_handle, bool a_wait_forever, TimeMs a_timeout)
+    {
+        const auto object_type = internal::handle::getObjectType( a_handle);
+
+        if ( internal::handle::ObjectType::StreamBuffer != object_type)
+        {
+            error::print( "Invalid handle! Underlying object type is not supported by this function.\n");
+            return sync::WaitResult::WaitFailed;
+        }
+
+        auto stream_buffer_id = internal::handle::getId< internal::stream_buffer::Id>( a_handle);
+
+        kernel::Handle not_full_condition = internal::handle::create(
+            internal::handle::ObjectType::StreamBufferNotFull,
+            stream_buffer_id
+        );
+
+        return sync::waitForSingleObject( not_full_condition, a_wait_forever, a_timeout);
+    }
+
+    bool size( kernel::Handle & a_handle, size_t & a_size)
+    {
+        const auto object_type = internal::handle::getObjectType( a_handle);
+
+        if ( internal::handle::ObjectType::StreamBuffer != object_type)
+        {
+            error::print( "Invalid handle! Underlying object type is not supported by this function.\n");
+            return false;
+        }
+
+        auto stream_buffer_id = internal::handle::getId< internal::stream_buffer::Id>( a_handle);
+
+        a_size = internal::stream_buffer::getSize( internal::context::m_objects.m_stream_buffers, stream_buffer_id);
+
+        return true;
+    }
+
+    bool setTriggerLevel( kernel::Handle & a_handle, size_t a_trigger_level)
+    {
+        return internal::setStreamBufferTriggerLevel( a_handle, internal::handle::ObjectType::StreamBuffer, a_trigger_level);
+    }
+}
+
+namespace kernel::message_buffer
+{
+    bool create(
+        kernel::Handle &        a_handle,
+        size_t                  a_data_max_size,
+        void * const            ap_static_buffer,
+        size_t                  a_trigger_level
+    )
+    {
+        return internal::createStreamBuffer(
+            a_handle,
+            internal::handle::ObjectType::MessageBuffer,
+            a_data_max_size,
+            ap_static_buffer,
+            a_trigger_level
+        );
+    }
+
+    void destroy( kernel::Handle & a_handle)
+    {
+        internal::destroyStreamBuffer( a_handle, internal::handle::ObjectType::MessageBuffer);
+    }
+
+    bool send( kernel::Handle & a_handle, const void * const ap_data, size_t a_length)
+    {
+        const auto object_type = internal::handle::getObjectType( a_handle);
+
+        if ( internal::handle::ObjectType::MessageBuffer != object_type)
+        {
+            error::print( "Invalid handle! Underlying object type is not supported by this function.\n");
+            return false;
+        }
+
+        if ( nullptr == ap_data)
+        {
+            error::print( "Invalid argument! Empty pointer to data!\n");
+            return false;
+        }
+
+        if ( ( 0U == a_length) || ( a_length > internal::stream_buffer::max_message_length))
+        {
+            error::print( "Invalid argument! Message length must be in range from 1 to 65535.\n");
+            return false;
+        }
+
+        auto stream_buffer_id = internal::handle::getId< internal::stream_buffer::Id>( a_handle);
+
+        const bool send_result = internal::stream_buffer::sendMessage(
+            internal::context::m_objects.m_stream_buffers,
+            stream_buffer_id,
+            ap_data,
+            a_length
+        );
+
+        if ( true == send_result)
+        {
+            internal::requestReschedule();
+        }
+
+        return send_result;
+    }
+
+    size_t receive( kernel::Handle & a_handle, void * const ap_data, size_t a_max_length)
+    {
+        const auto object_type = internal::handle::getObjectType( a_handle);
+
+        if ( internal::handle::ObjectType::MessageBuffer != object_type)
+        {
+            error::print( "Invalid handle! Underlying object type is not supported by this function.\n");
+            return 0U;
+        }
+
+        if ( nullptr == ap_data)
+        {
+            error::print( "Invalid argument! Empty pointer to data!\n");
+            return 0U;
+        }
+
+        auto stream_buffer_id = internal::handle::getId< internal::stream_buffer::Id>( a_handle);
+
+        return internal::stream_buffer::receiveMessage(
+            internal::context::m_objects.m_stream_buffers,
+            stream_buffer_id,
+            ap_data,
+            a_max_length
+        );
+    }
+
+    bool nextLength( kernel::Handle & a_handle, size_t & a_length)
+    {
+        const auto object_type = internal::handle::getObjectType( a_handle);
+
+        if ( internal::handle::ObjectType::MessageBuffer != object_type)
+        {
+            error::print( "Invalid handle! Underlying object type is not supported by this function.\n");
+            return false;
+        }
+
+        auto stream_buffer_id = internal::handle::getId< internal::stream_buffer::Id>( a_handle);
+
+        a_length = internal::stream_buffer::getNextMessageLength( internal::context::m_objects.m_stream_buffers, stream_buffer_id);
+
+        return true;
+    }
+
+    bool setTriggerLevel( kernel::Handle & a_handle, size_t a_trigger_level)
+    {
+        return internal::setStreamBufferTriggerLevel( a_handle, internal::handle::ObjectType::MessageBuffer, a_trigger_level);
+    }
+}
+
+namespace kernel::queue_set
+{
+    // Note: No lock is required since internal::queue_set API is already protected.
+    bool create( kernel::Handle & a_handle)
+    {
+        internal::queue_set::Id new_queue_set_id;
+
+        bool queue_set_created = internal::queue_set::create(
+            internal::context::m_objects.m_queue_sets,
+            new_queue_set_id
+        );
+
+        if ( false == queue_set_created)
+        {
+            error::print( "Failed to internally create queue set!\n");
+            return false;
+        }
+
+        a_handle = internal::handle::create( internal::handle::ObjectType::QueueSet, new_queue_set_id);
+
+        return true;
+    }
+
+    void destroy( kernel::Handle & a_handle)
+    {
+        const auto object_type = internal::handle::getObjectType( a_handle);
+
+        if ( internal::handle::ObjectType::QueueSet != object_type)
+        {
+            error::print( "Invalid handle! Underlying object type is not supported by this function.\n");
+            return;
+        }
+
+        auto queue_set_id = internal::handle::getId< internal::queue_set::Id>( a_handle);
+
+        internal::queue_set::destroy( internal::context::m_objects.m_queue_sets, queue_set_id);
+    }
+
+    bool add( kernel::Handle & a_handle, kernel::Handle & a_member)
+    {
+        const auto object_type = internal::handle::getObjectType( a_handle);
+
+        uint32_t member_slot;
+
+        if ( ( internal::handle::ObjectType::QueueSet != object_type) ||
+            ( false == internal::getQueueSetSlot( a_member, member_slot)))
+        {
+            error::print( "Invalid handle! Underlying object type is not supported by this function.\n");
+            return false;
+        }
+
+        if ( internal::handle::ObjectType::Queue == internal::handle::getObjectType( a_member))
+        {
+            auto queue_id = internal::handle::getId< internal::queue::Id>( a_member);
+
+            if ( true == internal::queue::isTyped( internal::context::m_objects.m_queues, queue_id))
+            {
+                error::print( "Invalid argument! Typed queue cannot be queue set member.\n");
+                return false;
+            }
+        }
+
+        auto queue_set_id = internal::handle::getId< internal::queue_set::Id>( a_handle);
+
+        bool member_added = internal::queue_set::addMember(
+            internal::context::m_objects.m_queue_sets,
+            queue_set_id,
+            member_slot,
+            a_member
+        );
+
+        if ( false == member_added)
+        {
+            error::print( "Invalid argument! Object is already a member of queue set.\n");
+            return false;
+        }
+
+        // Member could be ready before it was added.
+        if ( true == internal::isQueueSetMemberReady( a_member))
+        {
+            internal::notifyQueueSet( a_member);
+        }
+
+        return true;
+    }
+
+    bool remove( kernel::Handle & a_handle, kernel::Handle & a_member)
+    {
+        const auto object_type = internal::handle::getObjectType( a_handle);
+
+        uint32_t member_slot;
+
+        if ( ( internal::handle::ObjectType::QueueSet != object_type) ||
+            ( false == internal::getQueueSetSlot( a_member, member_slot)))
+        {
+            error::print( "Invalid handle! Underlying object type is not supported by this function.\n");
+            return false;
+        }
+
+        auto queue_set_id = internal::handle::getId< internal::queue_set::Id>( a_handle);
+
+        if ( false == internal::queue_set::isMember( internal::context::m_objects.m_queue_sets, member_slot, queue_set_id))
+        {
+            error::print( "Invalid argument! Object is not a member of this queue set.\n");
+            return false;
+        }
+
+        return internal::queue_set::removeMember( internal::context::m_objects.m_queue_sets, member_slot);
+    }
+
+    bool select( kernel::Handle & a_handle, kernel::Handle & a_member)
+    {
+        const auto object_type = internal::handle::getObjectType( a_handle);
+
+        if ( internal::handle::ObjectType::QueueSet != object_type)
+        {
+            error::print( "Invalid handle! Underlying object type is not supported by this function.\n");
+            return false;
+        }
+
+        auto queue_set_id = internal::handle::getId< internal::queue_set::Id>( a_handle);
+
+        internal::requeueLastSelected( queue_set_id);
+
+        kernel::Handle member;
+        uint32_t member_slot;
+
+        // Skip members, which are not ready anymore (ie. queue was emptied without select).
+        while ( true == internal::queue_set::pop( internal::context::m_objects.m_queue_sets, queue_set_id, member, member_slot))
+        {
+            if ( true == internal::takeReadyMember( member))
+            {
+                a_member = member;
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    // Note: While waiting, task is registered as the set receiver, so the first ready member
+    //       wakes it up directly.
+    bool select( kernel::Handle & a_handle, kernel::Handle & a_member, bool a_wait_forever, TimeMs a_timeout)
+    {
+        const auto object_type = internal::handle::getObjectType( a_handle);
+
+        if ( internal::handle::ObjectType::QueueSet != object_type)
+        {
+            error::print( "Invalid handle! Underlying object type is not supported by this function.\n");
+            return false;
+        }
+
+        auto queue_set_id = internal::handle::getId< internal::queue_set::Id>( a_handle);
+
+        internal::requeueLastSelected( queue_set_id);
+
+        const TimeMs start_time = getTime();
+
+        const kernel::Handle receiver = task::getCurrent();
+
+        while ( true)
+        {
+            kernel::Handle member;
+            uint32_t member_slot;
+
+            bool member_popped = internal::queue_set::popOrRegister(
+                internal::context::m_objects.m_queue_sets,
+                queue_set_id,
+                member,
+                member_slot,
+                receiver
+            );
+
+            if ( true == member_popped)
+            {
+                if ( true == internal::takeReadyMember( member))
+                {
+                    a_member = member;
+                    return true;
+                }
+
+                continue;
+            }
+
+            const TimeMs elapsed_time = getTime() - start_time;
+
+            bool timeout_elapsed = ( false == a_wait_forever) && ( elapsed_time >= a_timeout);
+
+            if ( false == timeout_elapsed)
+            {
+                const TimeMs remaining_time = ( true == a_wait_forever) ? 0U : a_timeout - elapsed_time;
+
+                timeout_elapsed = ( sync::WaitResult::ObjectSet != sync::waitForSingleObject( a_handle, a_wait_forever, remaining_time));
+            }
+
+            internal::queue_set::unregisterReceiver( internal::context::m_objects.m_queue_sets, queue_set_id);
+
+            if ( true == timeout_elapsed)
+            {
+                // Member could become ready, even if wait timed out.
+                return select( a_handle, a_member);
+            }
+        }
+    }
+}
+
+namespace kernel::event_group
+{
+    // Note: No lock is required since internal::event_group API is already protected.
+    bool create( kernel::Handle & a_handle)
+    {
+        internal::event_group::Id new_event_group_id;
+
+        bool event_group_created = internal::event_group::create(
+            internal::context::m_objects.m_event_groups,
+            new_event_group_id
+        );
+
+        if ( false == event_group_created)
+        {
+            error::print( "Failed to internally create event group!\n");
+            return false;
+        }
+
+        a_handle = internal::handle::create( internal::handle::ObjectType::EventGroup, new_event_group_id);
+
+        return true;
+    }
+
+    void destroy( kernel::Handle & a_handle)
+    {
+        const auto object_type = internal::handle::getObjectType( a_handle);
+
+        if ( internal::handle::ObjectType::EventGroup != object_type)
+        {
+            error::print( "Invalid handle! Underlying object type is not supported by this function.\n");
+            return;
+        }
+
+        auto event_group_id = internal::handle::getId< internal::event_group::Id>( a_handle);
+        internal::event_group::destroy( internal::context::m_objects.m_event_groups, event_group_id);
+    }
+
+    uint32_t set( kernel::Handle & a_handle, uint32_t a_flags)
+    {
+        const auto object_type = internal::handle::getObjectType( a_handle);
+
+        if ( internal::handle::ObjectType::EventGroup != object_type)
+        {
+            error::print( "Invalid handle! Underlying object type is not supported by this function.\n");
+            return 0U;
+        }
+
+        auto event_group_id = internal::handle::getId< internal::event_group::Id>( a_handle);
+
+        const uint32_t flags = internal::event_group::set( internal::context::m_objects.m_event_groups, event_group_id, a_flags);
+
+        internal::requestReschedule();
+
+        return flags;
+    }
+
+    uint32_t clear( kernel::Handle & a_handle, uint32_t a_flags)
+    {
+        const auto object_type = internal::handle::getObjectType( a_handle);
+
+        if ( internal::handle::ObjectType::EventGroup != object_type)
+        {
+            error::print( "Invalid handle! Underlying object type is not supported by this function.\n");
+            return 0U;
+        }
+
+        auto event_group_id = internal::handle::getId< internal::event_group::Id>( a_handle);
+
+        return internal::event_group::clear( internal::context::m_objects.m_event_groups, event_group_id, a_flags);
+    }
+
+    uint32_t get( kernel::Handle & a_handle)
+    {
+        const auto object_type = internal::handle::getObjectType( a_handle);
+
+        if ( internal::handle::ObjectType::EventGroup != object_type)
+        {
+            error::print( "Invalid handle! Underlying object type is not supported by this function.\n");
+            return 0U;
+        }
+
+        auto event_group_id = internal::handle::getId< internal::event_group::Id>( a_handle);
+
+        return internal::event_group::get( internal::context::m_objects.m_event_groups, event_group_id);
+    }
+
+    // Note: While waiting, task is registered as group waiter, so scheduler checks its mask
+    //       on each tick. Flags can be consumed by other waiter before task runs, so
+    //       condition is tested again after wake up.
+    kernel::sync::WaitResult wait(
+        kernel::Handle &    a_handle,
+        uint32_t            a_mask,
+        uint32_t &          a_flags,
+        bool                a_wait_for_all,
+        bool                a_clear_on_exit,
+        bool                a_wait_forever,
+        TimeMs              a_timeout
+    )
+    {
+        const auto object_type = internal::handle::getObjectType( a_handle);
+
+        if ( internal::handle::ObjectType::EventGroup != object_type)
+        {
+            error::print( "Invalid handle! Underlying object type is not supported by this function.\n");
+            return sync::WaitResult::WaitFailed;
+        }
+
+        if ( 0U == a_mask)
+        {
+            error::print( "Invalid argument! Wait mask should have at least one flag set.\n");
+            return sync::WaitResult::WaitFailed;
+        }
+
+        auto event_group_id = internal::handle::getId< internal::event_group::Id>( a_handle);
+
+        auto testAndClear = [ & ]()
+        {
+            return internal::event_group::testAndClear(
+                internal::context::m_objects.m_event_groups,
+                event_group_id,
+                a_mask,
+                a_wait_for_all,
+                a_clear_on_exit,
+                a_flags
+            );
+        };
+
+        if ( true == testAndClear())
+        {
+            return sync::WaitResult::ObjectSet;
+        }
+
+        if ( ( false == a_wait_forever) && ( 0U == a_timeout))
+        {
+            return sync::WaitResult::TimeoutOccurred;
+        }
+
+        const TimeMs start_time = getTime();
+
+        const uint32_t waiter_index = internal::handle::getId< uint32_t>( task::getCurrent());
+
+        kernel::Handle waiter_condition = internal::handle::create(
+            internal::handle::ObjectType::EventGroupWaiter,
+            waiter_index
+        );
+
+        internal::event_group::registerWaiter(
+            internal::context::m_objects.m_event_groups,
+            waiter_index,
+            event_group_id,
+            a_mask,
+            a_wait_for_all
+        );
+
+        sync::WaitResult result = sync::WaitResult::TimeoutOccurred;
+
+        while ( true)
+        {
+            TimeMs remaining_time = 0U;
+
+            if ( false == a_wait_forever)
+            {
+                const TimeMs elapsed_time = getTime() - start_time;
+
+                if ( elapsed_time >= a_timeout)
+                {
+                    break;
+                }
+
+                remaining_time = a_timeout - elapsed_time;
+            }
+
+            if ( sync::WaitResult::WaitFailed == sync::waitForSingleObject( waiter_condition, a_wait_forever, remaining_time))
+            {
+                result = sync::WaitResult::WaitFailed;
+                break;
+            }
+
+            if ( true == testAndClear())
+            {
+                result = sync::WaitResult::ObjectSet;
+                break;
+            }
+        }
+
+        internal::event_group::unregisterWaiter( internal::context::m_objects.m_event_groups, waiter_index);
+
+        return result;
+    }
+}
+
+namespace kernel::semaphore
+{
+    // Note: No lock is required since internal::semaphore API is already protected.
+    bool create( kernel::Handle & a_handle, uint32_t a_max_count, uint32_t a_initial_count)
+    {
+        if ( 0U == a_max_count)
+        {
+            error::print( "Invalid argument! Maximum count must be bigger than 0.\n");
+            return false;
+        }
+
+        if ( a_initial_count > a_max_count)
+        {
+            error::print( "Invalid argument! Initial count is bigger than maximum count.\n");
+            return false;
+        }
+
+        internal::semaphore::Id new_semaphore_id;
+
+        bool semaphore_created = internal::semaphore::create(
+            internal::context::m_objects.m_semaphores,
+            new_semaphore_id,
+            a_max_count,
+            a_initial_count
+        );
+
+        if ( false == semaphore_created)
+        {
+            error::print( "Failed to internally create semaphore!\n");
+            return false;
+        }
+
+        a_handle = internal::handle::create( internal::handle::ObjectType::Semaphore, new_semaphore_id);
+
+        return true;
+    }
+
+    void destroy( kernel::Handle & a_handle)
+    {
+        const auto object_type = internal::handle::getObjectType( a_handle);
+
+        if ( internal::handle::ObjectType::Semaphore != object_type)
+        {
+            error::print( "Invalid handle! Underlying object type is not supported by this function.\n");
+            return;
+        }
+
+        auto semaphore_id = internal::handle::getId< internal::semaphore::Id>( a_handle);
+        internal::semaphore::destroy( internal::context::m_objects.m_semaphores, semaphore_id);
+    }
+
+    bool give( kernel::Handle & a_handle)
+    {
+        const auto object_type = internal::handle::getObjectType( a_handle);
+
+        if ( internal::handle::ObjectType::Semaphore != object_type)
+        {
+            error::print( "Invalid handle! Underlying object type is not supported by this function.\n");
+            return false;
+        }
+
+        auto semaphore_id = internal::handle::getId< internal::semaphore::Id>( a_handle);
+
+        const bool give_result = internal::semaphore::give( internal::context::m_objects.m_semaphores, semaphore_id);
+
+        if ( true == give_result)
+        {
+            internal::requestReschedule();
+        }
+
+        return give_result;
+    }
+
+    bool take( kernel::Handle & a_handle)
+    {
+        const auto object_type = internal::handle::getObjectType( a_handle);
+
+        if ( internal::handle::ObjectType::Semaphore != object_type)
+        {
+            error::print( "Invalid handle! Underlying object type is not supported by this function.\n");
+            return false;
+        }
+
+        auto semaphore_id = internal::handle::getId< internal::semaphore::Id>( a_handle);
+
+        return internal::semaphore::take( internal::context::m_objects.m_semaphores, semaphore_id);
+    }
+
+    // Note: Count can be taken by other task before woken task runs, so take is tried
+    //       again after each wake up.
+    bool take( kernel::Handle & a_handle, bool a_wait_forever, TimeMs a_timeout)
+    {
+        const auto object_type = internal::handle::getObjectType( a_handle);
+
+        if ( internal::handle::ObjectType::Semaphore != object_type)
+        {
+            error::print( "Invalid handle! Underlying object type is not supported by this function.\n");
+            return false;
+        }
+
+        auto semaphore_id = internal::handle::getId< internal::semaphore::Id>( a_handle);
+
+        const TimeMs start_time = getTime();
+
+        while ( false == internal::semaphore::take( internal::context::m_objects.m_semaphores, semaphore_id))
+        {
+            const TimeMs elapsed_time = getTime() - start_time;
+
+            if ( ( false == a_wait_forever) && ( elapsed_time >= a_timeout))
+            {
+                return false;
+            }
+
+            const TimeMs remaining_time = ( true == a_wait_forever) ? 0U : a_timeout - elapsed_time;
+
+            if ( sync::WaitResult::WaitFailed == sync::waitForSingleObject( a_handle, a_wait_forever, remaining_time))
+            {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    bool count( kernel::Handle & a_handle, uint32_t & a_count)
+    {
+        const auto object_type = internal::handle::getObjectType( a_handle);
+
+        if ( internal::handle::ObjectType::Semaphore != object_type)
+        {
+            error::print( "Invalid handle! Underlying object type is not supported by this function.\n");
+            return false;
+        }
+
+        auto semaphore_id = internal::handle::getId< internal::semaphore::Id>( a_handle);
+
+        a_count = internal::semaphore::getCount( internal::context::m_objects.m_semaphores, semaphore_id);
+
+        return true;
+    }
+}
+
+namespace kernel::rw_lock
+{
+    // Note: No lock is required since internal::rw_lock API is already protected.
+    bool create( kernel::Handle & a_handle, Policy a_policy)
+    {
+        internal::rw_lock::Id new_rw_lock_id;
+
+        bool rw_lock_created = internal::rw_lock::create(
+            internal::context::m_objects.m_rw_locks,
+            new_rw_lock_id,
+            a_policy
+        );
+
+        if ( false == rw_lock_created)
+        {
+            error::print( "Failed to internally create reader-writer lock!\n");
+            return false;
+        }
+
+        a_handle = internal::handle::create( internal::handle::ObjectType::RwLock, new_rw_lock_id);
+
+        return true;
+    }
+
+    void destroy( kernel::Handle & a_handle)
+    {
+        const auto object_type = internal::handle::getObjectType( a_handle);
+
+        if ( internal::handle::ObjectType::RwLock != object_type)
+        {
+            error::print( "Invalid handle! Underlying object type is not supported by this function.\n");
+            return;
+        }
+
+        auto rw_lock_id = internal::handle::getId< internal::rw_lock::Id>( a_handle);
+        internal::rw_lock::destroy( internal::context::m_objects.m_rw_locks, rw_lock_id);
+    }
+
+    bool tryLockRead( kernel::Handle & a_handle)
+    {
+        const auto object_type = internal::handle::getObjectType( a_handle);
+
+        if ( internal::handle::ObjectType::RwLock != object_type)
+        {
+            error::print( "Invalid handle! Underlying object type is not supported by this function.\n");
+            return false;
+        }
+
+        auto rw_lock_id = internal::handle::getId< internal::rw_lock::Id>( a_handle);
+
+        return internal::rw_lock::tryLockRead( internal::context::m_objects.m_rw_locks, rw_lock_id);
+    }
+
+    bool tryLockWrite( kernel::Handle & a_handle)
+    {
+        const auto object_type = internal::handle::getObjectType( a_handle);
+
+        if ( internal::handle::ObjectType::RwLock != object_type)
+        {
+            error::print( "Invalid handle! Underlying object type is not supported by this function.\n");
+            return false;
+        }
+
+        auto rw_lock_id = internal::handle::getId< internal::rw_lock::Id>( a_handle);
+
+        return internal::rw_lock::tryLockWrite( internal::context::m_objects.m_rw_locks, rw_lock_id);
+    }
+
+    // Note: Lock can be taken by other task before woken task runs, so lock is tried
+    //       again after each wake up.
+    bool lockRead( kernel::Handle & a_handle, bool a_wait_forever, TimeMs a_timeout)
+    {
+        const auto object_type = internal::handle::getObjectType( a_handle);
+
+        if ( internal::handle::ObjectType::RwLock != object_type)
+        {
+            error::print( "Invalid handle! Underlying object type is not supported by this function.\n");
+            return false;
+        }
+
+        auto rw_lock_id = internal::handle::getId< internal::rw_lock::Id>( a_handle);
+
+        const TimeMs start_time = getTime();
+
+        while ( false == internal::rw_lock::tryLockRead( internal::context::m_objects.m_rw_locks, rw_lock_id))
+        {
+            const TimeMs elapsed_time = getTime() - start_time;
+
+            if ( ( false == a_wait_forever) && ( elapsed_time >= a_timeout))
+            {
+                return false;
+            }
+
+            const TimeMs remaining_time = ( true == a_wait_forever) ? 0U : a_timeout - elapsed_time;
+
+            if ( sync::WaitResult::WaitFailed == sync::waitForSingleObject( a_handle, a_wait_forever, remaining_time))
+            {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    // Note: Writer is counted as waiting for the whole call, so with PreferWriter policy
+    //       new readers don't take the lock between its wake ups.
+    bool lockWrite( kernel::Handle & a_handle, bool a_wait_forever, TimeMs a_timeout)
+    {
+        const auto object_type = internal::handle::getObjectType( a_handle);
+
+        if ( internal::handle::ObjectType::RwLock != object_type)
+        {
+            error::print( "Invalid handle! Underlying object type is not supported by this function.\n");
+            return false;
+        }
+
+        auto rw_lock_id = internal::handle::getId< internal::rw_lock::Id>( a_handle);
+
+        if ( true == internal::rw_lock::tryLockWrite( internal::context::m_objects.m_rw_locks, rw_lock_id))
+        {
+            return true;
+        }
+
+        kernel::Handle writer_handle = internal::handle::create( internal::handle::ObjectType::RwLockWriter, rw_lock_id);
+
+        const TimeMs start_time = getTime();
+        bool is_locked = false;
+
+        internal::rw_lock::addWaitingWriter( internal::context::m_objects.m_rw_locks, rw_lock_id);
+
+        while ( false == ( is_locked = internal::rw_lock::tryLockWrite( internal::context::m_objects.m_rw_locks, rw_lock_id)))
+        {
+            const TimeMs elapsed_time = getTime() - start_time;
+
+            if ( ( false == a_wait_forever) && ( elapsed_time >= a_timeout))
+            {
+                break;
+            }
+
+            const TimeMs remaining_time = ( true == a_wait_forever) ? 0U : a_timeout - elapsed_time;
+
+            if ( sync::WaitResult::WaitFailed == sync::waitForSingleObject( writer_handle, a_wait_forever, remaining_time))
+            {
+                break;
+            }
+        }
+
+        internal::rw_lock::removeWaitingWriter( internal::context::m_objects.m_rw_locks, rw_lock_id);
+
+        return is_locked;
+    }
+
+    void unlockRead( kernel::Handle & a_handle)
+    {
+        const auto object_type = internal::handle::getObjectType( a_handle);
+
+        if ( internal::handle::ObjectType::RwLock != object_type)
+        {
+            error::print( "Invalid handle! Underlying object type is not supported by this function.\n");
+            return;
+        }
+
+        auto rw_lock_id = internal::handle::getId< internal::rw_lock::Id>( a_handle);
+
+        if ( false == internal::rw_lock::unlockRead( internal::context::m_objects.m_rw_locks, rw_lock_id))
+        {
+            error::print( "Reader-writer lock is not read!\n");
+            return;
+        }
+
+        internal::requestReschedule();
+    }
+
+    void unlockWrite( kernel::Handle & a_handle)
+    {
+        const auto object_type = internal::handle::getObjectType( a_handle);
+
+        if ( internal::handle::ObjectType::RwLock != object_type)
+        {
+            error::print( "Invalid handle! Underlying object type is not supported by this function.\n");
+            return;
+        }
+
+        auto rw_lock_id = internal::handle::getId< internal::rw_lock::Id>( a_handle);
+
+        if ( false == internal::rw_lock::unlockWrite( internal::context::m_objects.m_rw_locks, rw_lock_id))
+        {
+            error::print( "Reader-writer lock is not written!\n");
+            return;
+        }
+
+        internal::requestReschedule();
+    }
+}
+
+namespace kernel::internal
+{
+    // Remove task from scheduler and internal::task.
+    void terminateTask( task::Id a_id)
+    {
+        internal::lock::enter( context::m_lock);
+        {
+            const auto current_task = scheduler::getCurrentTaskId( context::m_scheduler);
+
+            scheduler::removeTask( context::m_scheduler, context::m_tasks, a_id);
+
+            // Registered receive buffer is on the stack of terminated task.
+            queue::unregisterTask( context::m_objects.m_queues, handle::create( handle::ObjectType::Task, a_id));
+
+            internal::task::destroy( context::m_tasks, a_id);
+
+            // Reschedule in case task is killing itself.
+            if ( current_task == a_id)
+            {
+                if ( true == context::m_started)
+                {
+                    hardware::syscall( hardware::SyscallId::LoadNextTask);
+                }
+                else
+                {
+                    internal::lock::leave( context::m_lock);
+                }
+            }
+            else
+            {
+                internal::lock::leave( context::m_lock);
+            }
+        }
+    }
+
+    // Make task, which received queue item by direct handoff, Ready in the same kernel entry.
+    // Context switch is issued if it has higher priority than the sender.
+    // Note: From interrupt routine, receiver is woken up by reschedule pended by requestReschedule.
+    void wakeQueueReceiver( kernel::Handle & a_receiver)
+    {
+        if ( ( false == context::m_started) || ( true == hardware::utility::isHandlerMode()))
+        {
+            return;
+        }
+
+        internal::lock::enter( context::m_lock);
+        {
+            auto receiver_task_id = handle::getId< task::Id>( a_receiver);
+
+            bool receiver_woken = scheduler::wakeWaitingTask(
+                context::m_scheduler,
+                context::m_tasks,
+                receiver_task_id,
+                kernel::sync::WaitResult::ObjectSet,
+                0U
+            );
+
+            const auto current_task_id = scheduler::getCurrentTaskId( context::m_scheduler);
+
+            const auto current_task_priority = internal::task::priority::get( context::m_tasks, current_task_id);
+            const auto receiver_priority = internal::task::priority::get( context::m_tasks, receiver_task_id);
+
+            if ( ( true == receiver_woken) && ( receiver_priority < current_task_priority))
+            {
+                hardware::syscall( hardware::SyscallId::ExecuteContextSwitch);
+            }
+            else
+            {
+                internal::lock::leave( context::m_lock);
+            }
+        }
+    }
+
+    // Called after kernel object was changed. From interrupt routine, reschedule is pended,
+    // so task woken up by this change preempts current task as soon as interrupt routine exits.
+    void requestReschedule()
+    {
+        if ( ( false == context::m_started) || ( false == hardware::utility::isHandlerMode()))
+        {
+            return;
+        }
+
+        context::m_reschedule_pending = true;
+
+        hardware::pendReschedule();
+    }
+
+    // Make notified task Ready in the same kernel entry, like queue receiver.
+    // From interrupt routine, or when task is not yet Waiting, it is woken up by the next tick or pended reschedule.
+    void wakeNotifiedTask( task::Id & a_id)
+    {
+        if ( false == task::notification::isWaiting( context::m_tasks, a_id))
+        {
+            return;
+        }
+
+        if ( ( false == context::m_started) || ( true == hardware::utility::isHandlerMode()))
+        {
+            context::m_notification_pending = true;
+            return;
+        }
+
+        internal::lock::enter( context::m_lock);
+        {
+            bool task_woken = scheduler::wakeWaitingTask(
+                context::m_scheduler,
+                context::m_tasks,
+                a_id,
+                kernel::sync::WaitResult::ObjectSet,
+                0U
+            );
+
+            if ( false == task_woken)
+            {
+                context::m_notification_pending = true;
+            }
+
+            const auto current_task_id = scheduler::getCurrentTaskId( context::m_scheduler);
+
+            const auto current_task_priority = internal::task::priority::get( context::m_tasks, current_task_id);
+            const auto notified_task_priority = internal::task::priority::get( context::m_tasks, a_id);
+
+            if ( ( true == task_woken) && ( notified_task_priority < current_task_priority))
+            {
+                hardware::syscall( hardware::SyscallId::ExecuteContextSwitch);
+            }
+            else
+            {
+                internal::lock::leave( context::m_lock);
+            }
+        }
     }
-}
 
-namespace kernel::internal
-{
-    // Remove task from scheduler and internal::task.
-    void terminateTask( task::Id a_id)
+    // Called by system tick only when notification is pending, so there is no cost otherwise.
+    void wakeNotifiedTasks()
     {
-        internal::lock::enter( context::m_lock);
+        if ( false == context::m_notification_pending)
         {
-            const auto current_task = scheduler::getCurrentTaskId( context::m_scheduler);
+            return;
+        }
 
-            scheduler::removeTask( context::m_scheduler, context::m_tasks, a_id);
+        // Clear before scan, so notification set by interrupt during scan is not lost.
+        context::m_notification_pending = false;
 
-            internal::task::destroy( context::m_tasks, a_id);
+        for ( uint32_t i = 0U; i < internal::task::max_number; ++i)
+        {
+            const auto task_index = static_cast< task::MemoryBufferIndex>( i);
 
-            // Reschedule in case task is killing itself.
-            if ( current_task == a_id)
+            if ( false == context::m_tasks.m_data.isAllocated( task_index))
             {
-                if ( true == context::m_started)
-                {
-                    hardware::syscall( hardware::SyscallId::LoadNextTask);
-                }
-                else
+                continue;
+            }
+
+            auto task_id = static_cast< task::Id>( i);
+
+            if ( false == task::notification::isPending( context::m_tasks, task_id))
+            {
+                continue;
+            }
+
+            bool task_woken = scheduler::wakeWaitingTask(
+                context::m_scheduler,
+                context::m_tasks,
+                task_id,
+                kernel::sync::WaitResult::ObjectSet,
+                0U
+            );
+
+            // Task was notified before it started waiting. Try again on the next tick.
+            if ( false == task_woken)
+            {
+                context::m_notification_pending = true;
+            }
+        }
+    }
+
+    bool setQueueTriggerLevel( kernel::Handle & a_handle, size_t a_trigger_level, bool a_has_batch_timeout, TimeMs a_batch_timeout)
+    {
+        const auto object_type = handle::getObjectType( a_handle);
+
+        if ( handle::ObjectType::Queue != object_type)
+        {
+            error::print( "Invalid handle! Underlying object type is not supported by this function.\n");
+            return false;
+        }
+
+        if ( 0U == a_trigger_level)
+        {
+            error::print( "Invalid argument! Trigger level must be bigger than 0.\n");
+            return false;
+        }
+
+        auto queue_id = handle::getId< queue::Id>( a_handle);
+
+        queue::setTriggerLevel( context::m_objects.m_queues, queue_id, a_trigger_level, a_has_batch_timeout, a_batch_timeout);
+
+        return true;
+    }
+
+    // Register name of created object. Unnamed objects are not registered. Without name
+    // registry, name is only kept in the object and its uniqueness is not checked.
+    bool registerName( const kernel::Handle & a_handle, const kernel::Name & a_name)
+    {
+        if ( ( nullptr == a_name.mp_string) || ( 0U == registry::max_number))
+        {
+            return true;
+        }
+
+        if ( false == registry::add( context::m_registry, a_name, a_handle))
+        {
+            error::print( "Failed to register object name! Name is already used or name registry is full.\n");
+            return false;
+        }
+
+        return true;
+    }
+
+    void unregisterName( const char * const ap_name)
+    {
+        if ( ( nullptr != ap_name) && ( 0U != registry::max_number))
+        {
+            registry::remove( context::m_registry, kernel::Name{ ap_name});
+        }
+    }
+
+    bool openByName( kernel::Handle & a_handle, const kernel::Name & a_name, handle::ObjectType a_object_type)
+    {
+        if constexpr ( 0U == registry::max_number)
+        {
+            // Without name registry named objects are found by name pointer, so the same
+            // literal must be used on create and open.
+            if ( handle::ObjectType::Event == a_object_type)
+            {
+                event::Id event_id;
+
+                if ( false == event::open( context::m_objects.m_events, event_id, a_name.mp_string))
                 {
-                    internal::lock::leave( context::m_lock);
+                    return false;
                 }
+
+                a_handle = handle::create( handle::ObjectType::Event, event_id);
+                return true;
             }
-            else
+
+            queue::Id queue_id;
+
+            if ( false == queue::open( context::m_objects.m_queues, queue_id, a_name.mp_string))
+            {
+                return false;
+            }
+
+            a_handle = handle::create( handle::ObjectType::Queue, queue_id);
+            return true;
+        }
+
+        kernel::Handle found_handle;
+
+        if ( false == registry::find( context::m_registry, a_name, found_handle))
+        {
+            return false;
+        }
+
+        if ( a_object_type != handle::getObjectType( found_handle))
+        {
+            error::print( "Invalid name! Named object type is not supported by this function.\n");
+            return false;
+        }
+
+        a_handle = found_handle;
+
+        return true;
+    }
+
+    // Map queue set member handle to its slot: static queues take the first slots, events
+    // the following ones. Return 'false' for unsupported object type.
+    bool getQueueSetSlot( const kernel::Handle & a_member, uint32_t & a_slot)
+    {
+        if constexpr ( 0U == queue_set::max_number)
+        {
+            return false;
+        }
+
+        switch ( handle::getObjectType( a_member))
+        {
+        case handle::ObjectType::Queue:
+        {
+            a_slot = static_cast< uint32_t>( handle::getId< queue::Id>( a_member));
+            return ( a_slot < queue::max_number);
+        }
+        case handle::ObjectType::Event:
+        {
+            a_slot = static_cast< uint32_t>( handle::getId< event::Id>( a_member));
+
+            if ( a_slot >= event::max_number)
+            {
+                return false;
+            }
+
+            a_slot += static_cast< uint32_t>( queue::max_number);
+            return true;
+        }
+        default:
+            return false;
+        }
+    }
+
+    // Append ready member to its queue set, if it belongs to any, and wake up set receiver.
+    void notifyQueueSet( const kernel::Handle & a_member)
+    {
+        uint32_t member_slot;
+
+        if ( false == getQueueSetSlot( a_member, member_slot))
+        {
+            return;
+        }
+
+        // Set to receiver Task handle only if it was waiting for the set.
+        kernel::Handle woken_receiver = a_member;
+
+        queue_set::notify( context::m_objects.m_queue_sets, member_slot, &woken_receiver);
+
+        if ( handle::ObjectType::Task == handle::getObjectType( woken_receiver))
+        {
+            wakeQueueReceiver( woken_receiver);
+        }
+    }
+
+    void leaveQueueSet( const kernel::Handle & a_member)
+    {
+        uint32_t member_slot;
+
+        if ( true == getQueueSetSlot( a_member, member_slot))
+        {
+            ( void) queue_set::removeMember( context::m_objects.m_queue_sets, member_slot);
+        }
+    }
+
+    bool isQueueSetMemberReady( const kernel::Handle & a_member)
+    {
+        return handle::isQueueSetMemberReady( context::m_objects, a_member);
+    }
+
+    // Queue member selected last time is queued again, if receiver left items in it.
+    void requeueLastSelected( queue_set::Id & a_id)
+    {
+        kernel::Handle member;
+        uint32_t member_slot;
+
+        if ( false == queue_set::takeLastSelected( context::m_objects.m_queue_sets, a_id, member, member_slot))
+        {
+            return;
+        }
+
+        if ( true == isQueueSetMemberReady( member))
+        {
+            queue_set::notify( context::m_objects.m_queue_sets, member_slot, nullptr);
+        }
+    }
+
+    // Return 'true' if popped member is still ready. Auto reset event is reset.
+    bool takeReadyMember( const kernel::Handle & a_member)
+    {
+        const bool is_member_ready = isQueueSetMemberReady( a_member);
+
+        if ( true == is_member_ready)
+        {
+            handle::resetState( context::m_objects, a_member);
+        }
+
+        return is_member_ready;
+    }
+
+    // Stream and Message buffers share the same internal object, but are told apart by handle type.
+    bool createStreamBuffer(
+        kernel::Handle &        a_handle,
+        handle::ObjectType      a_object_type,
+        size_t                  a_data_max_size,
+        void * const            ap_static_buffer,
+        size_t                  a_trigger_level
+    )
+    {
+        if ( nullptr == ap_static_buffer)
+        {
+            error::print( "Invalid argument! Empty pointer to static buffer!\n");
+            return false;
+        }
+
+        const bool is_message_buffer = ( handle::ObjectType::MessageBuffer == a_object_type);
+
+        // Message buffer must fit at least one byte long message.
+        const size_t min_data_max_size = is_message_buffer ? ( sizeof( stream_buffer::MessageLength) + 1U) : 1U;
+
+        if ( a_data_max_size < min_data_max_size)
+        {
+            error::print( "Invalid argument! Buffer is too small.\n");
+            return false;
+        }
+
+        if ( ( 0U == a_trigger_level) || ( a_trigger_level > a_data_max_size))
+        {
+            error::print( "Invalid argument! Trigger level must be in range from 1 to buffer size.\n");
+            return false;
+        }
+
+        internal::lock::enter( context::m_lock);
+        {
+            stream_buffer::Id created_buffer_id;
+
+            bool buffer_created = stream_buffer::create(
+                context::m_objects.m_stream_buffers,
+                created_buffer_id,
+                a_data_max_size,
+                ap_static_buffer,
+                a_trigger_level,
+                is_message_buffer
+            );
+
+            if ( false == buffer_created)
             {
+                error::print( "Failed to internally create stream buffer!\n");
                 internal::lock::leave( context::m_lock);
+                return false;
             }
+
+            a_handle = handle::create( a_object_type, created_buffer_id);
+        }
+        internal::lock::leave( context::m_lock);
+
+        return true;
+    }
+
+    void destroyStreamBuffer( kernel::Handle & a_handle, handle::ObjectType a_object_type)
+    {
+        if ( a_object_type != handle::getObjectType( a_handle))
+        {
+            error::print( "Invalid handle! Underlying object type is not supported by this function.\n");
+            return;
+        }
+
+        internal::lock::enter( context::m_lock);
+        {
+            auto stream_buffer_id = handle::getId< stream_buffer::Id>( a_handle);
+            stream_buffer::destroy( context::m_objects.m_stream_buffers, stream_buffer_id);
+        }
+        internal::lock::leave( context::m_lock);
+    }
+
+    bool setStreamBufferTriggerLevel( kernel::Handle & a_handle, handle::ObjectType a_object_type, size_t a_trigger_level)
+    {
+        if ( a_object_type != handle::getObjectType( a_handle))
+        {
+            error::print( "Invalid handle! Underlying object type is not supported by this function.\n");
+            return false;
+        }
+
+        if ( 0U == a_trigger_level)
+        {
+            error::print( "Invalid argument! Trigger level must be bigger than 0.\n");
+            return false;
         }
+
+        auto stream_buffer_id = handle::getId< stream_buffer::Id>( a_handle);
+        stream_buffer::setTriggerLevel( context::m_objects.m_stream_buffers, stream_buffer_id, a_trigger_level);
+
+        return true;
     }
 
     // Task routine wrapper used by kernel.
@@ -1005,7 +3697,11 @@ namespace kernel::internal
     // TODO: calculate CPU load
     // TODO: consider creating callback instead of 'weak' attribute, where kernel API
     //       functions won't work (Terminate on Idle task is a bad idea - UB).
-    __attribute__(( weak)) void idleTaskRoutine( void * a_parameter)
+    // Note: MSVC (unit tests) has no weak symbols and tests do not replace Idle routine.
+    #ifdef __GNUC__
+        __attribute__(( weak))
+    #endif
+    void idleTaskRoutine( void * a_parameter)
     {
         while (true)
         {
@@ -1013,6 +3709,42 @@ namespace kernel::internal
             kernel::hardware::interrupt::wait();
         }
     }
+
+    // Call callbacks of expired timers. Task is notified by tick, when any callback is pending.
+    void timerTaskRoutine( void * a_parameter)
+    {
+        while ( true)
+        {
+            uint32_t notification_value;
+
+            ( void) kernel::task::notifyWait( notification_value);
+
+            kernel::timer::Callback callback;
+            void * callback_parameter;
+
+            while ( true == timer::takeCallback( context::m_objects.m_timers, callback, callback_parameter))
+            {
+                callback( callback_parameter);
+            }
+        }
+    }
+
+    // Note: Called only by kernel::init, before kernel is started, so no other task can
+    //       create timer with callback in the meantime.
+    bool createTimerTask()
+    {
+        kernel::Handle timer_task;
+
+        if ( false == kernel::task::create( timerTaskRoutine, timer::task_priority, &timer_task))
+        {
+            return false;
+        }
+
+        context::m_timer_task = handle::getId< task::Id>( timer_task);
+        context::m_timer_task_created = true;
+
+        return true;
+    }
 }
 
 namespace kernel::internal
@@ -1112,30 +3844,56 @@ namespace kernel::internal
         //       should be reset when syscall is used by user.
     }
 
-    bool tick() 
+    bool tick( bool a_is_time_elapsed)
     {
         bool execute_context_switch = false;
 
-        // If lock is enabled, increment time, but delay scheduler.
-        if ( lock::isLocked( context::m_lock))
+        // If lock is taken, increment time, but defer scheduler until lock is released.
+        // Note: Reschedule request is kept until then as well.
+        if ( true == lock::isLocked( context::m_lock))
         {
+            lock::deferTick( context::m_lock);
+        }
+        else
+        {
+            // Tick deferred by lock runs the round-robin it could have missed and lets
+            // tasks woken up in the meantime preempt current task.
+            const bool is_tick_deferred = lock::takeDeferredTick( context::m_lock);
+
             TimeMs current_time = system_timer::get( context::m_systemTimer);
 
-            timer::tick( context::m_timers, current_time);
+            // Timer service task runs callbacks of expired timers with its own priority,
+            // so it preempts current task, if it has higher priority.
+            const bool is_timer_task_notified =
+                ( true == timer::tick( context::m_objects.m_timers, current_time)) &&
+                ( true == context::m_timer_task_created);
+
+            if ( true == is_timer_task_notified)
+            {
+                ( void) task::notification::notify( context::m_tasks, context::m_timer_task, 1U, kernel::task::NotifyAction::Overwrite);
+                wakeNotifiedTask( context::m_timer_task);
+            }
+
+            const bool is_reschedule_requested =
+                ( true == is_tick_deferred) ||
+                ( true == context::m_reschedule_pending) ||
+                ( true == is_timer_task_notified);
+            context::m_reschedule_pending = false;
+
+            queue::tickStats( context::m_objects.m_queues, current_time);
+            wakeNotifiedTasks();
 
             // TODO: if task of priority higher than currently running
             //       has woken up - reschedule everything.
             scheduler::checkWaitConditions(
                 context::m_scheduler,
                 context::m_tasks,
-                context::m_timers,
-                context::m_events,
-                context::m_queue,
+                context::m_objects,
                 current_time
             );
 
             // Calculate Round-Robin time stamp
-            bool interval_elapsed = system_timer::isIntervalElapsed(
+            bool interval_elapsed = ( ( true == a_is_time_elapsed) || ( true == is_tick_deferred)) && system_timer::isIntervalElapsed(
                 context::m_systemTimer
             );
 
@@ -1167,9 +3925,26 @@ namespace kernel::internal
                     }
                 }
             }
+            else if ( true == is_reschedule_requested)
+            {
+                // Task woken up by interrupt routine runs at once, if it has higher priority.
+                task::Id current_task = scheduler::getCurrentTaskId( context::m_scheduler);
+                task::Id next_task;
+
+                if ( true == scheduler::preemptCurrentTask( context::m_scheduler, context::m_tasks, next_task))
+                {
+                    storeContext( context::m_tasks, current_task);
+                    loadContext( context::m_tasks, next_task);
+
+                    execute_context_switch = true;
+                }
+            }
         }
 
-        system_timer::increment( context::m_systemTimer);
+        if ( true == a_is_time_elapsed)
+        {
+            system_timer::increment( context::m_systemTimer);
+        }
 
         return execute_context_switch;
     }
@@ -29,6 +29,46 @@ namespace kernel
 
     // Return core frequency in Hz.
     uint32_t getCoreFrequencyHz();
+
+    // 32-bit FNV-1a hash of object name.
+    constexpr uint32_t hashName( const char * ap_name)
+    {
+        uint32_t hash = 0x811C'9DC5U;
+
+        while ( '\0' != *ap_name)
+        {
+            hash ^= static_cast< uint8_t>( *ap_name);
+            hash *= 0x0100'0193U;
+            ++ap_name;
+        }
+
+        return hash;
+    }
+
+    // Name of system object, used to find it in kernel name registry.
+    // Name string must be pointer to compile time available literal or UB.
+    // Hash is computed at compile time for constexpr Name, so lookup does not touch the string
+    // unless hashes collide. Literal passed directly to API is usually hashed by the compiler too.
+    struct Name
+    {
+        const char *    mp_string{ nullptr};
+        uint32_t        m_hash{ 0U};
+
+        constexpr Name() = default;
+        constexpr Name( const char * ap_string) :
+            mp_string{ ap_string},
+            m_hash{ ( nullptr != ap_string) ? hashName( ap_string) : 0U}
+        {
+        }
+    };
+
+    // Bind a_handle to object name. a_handle is written when object named a_name is created,
+    // or at once if it already exists, and reset to empty handle when object is destroyed.
+    // Interrupt handlers can then use a_handle directly, without any open call. a_handle must
+    // outlive the binding (ie. be a global variable).
+    // Return false if name registry is full or name is already bound to other handle.
+    // Note: Cannot be used from within interrupt handler.
+    bool bind( kernel::Handle & a_handle, const kernel::Name & a_name);
 }
 
 // User API for controling tasks.
@@ -54,6 +94,14 @@ namespace kernel::task
         Running
     };
 
+    // Operation performed on notification value of notified task.
+    enum class NotifyAction
+    {
+        SetBits,    // Bitwise OR with provided value.
+        Increment,  // Provided value is ignored.
+        Overwrite
+    };
+
     // Create new task. Can be created statically (before calling kernel::start()),
     // and in run-time, by other tasks.
     bool create(
@@ -83,7 +131,22 @@ namespace kernel::task
 // User API for controling software timers.
 namespace kernel::timer
 {
+    using Callback = void( *)( void * a_parameter);
+
     bool create( kernel::Handle & a_handle, TimeMs a_interval);
+
+    // Timer calls a_callback each time it expires. Auto-reload timer is started again from its
+    // own deadline, so its period does not drift. Callbacks are called one by one by kernel
+    // timer service task, so they share its stack and should not block.
+    // Return false if timer callbacks are disabled with KERNEL_TIMER_CALLBACK_ENABLE.
+    // Note: Auto-reload timer never finishes, so it is not signaled for waitForObject functions.
+    bool create(
+        kernel::Handle &    a_handle,
+        TimeMs              a_interval,
+        Callback            a_callback,
+        void * const        a_parameter = nullptr,
+        bool                a_auto_reload = false
+    );
     void destroy( kernel::Handle & a_handle);
     void start( kernel::Handle & a_handle);
     void restart( kernel::Handle & a_handle);
@@ -96,15 +159,15 @@ namespace kernel::event
 {
     // If a_manual_reset is set to false, event will be reset when waitForObject
     // function completes. In other case, you have to manualy call reset.
-    // ap_name parameter must be pointer to compile time available literal or UB.
+    // Named event is registered in kernel name registry. Name must be unique.
     bool create(
-        kernel::Handle &    a_handle,
-        bool                a_manual_reset = false,
-        const char * const  ap_name = nullptr
+        kernel::Handle &        a_handle,
+        bool                    a_manual_reset = false,
+        const kernel::Name &    a_name = kernel::Name{}
     );
 
-    // ap_name parameter must point to compile time available literal or UB.
-    bool open( kernel::Handle & a_handle, const char * const ap_name);
+    // Find event in kernel name registry. Lookup cost does not depend on number of objects.
+    bool open( kernel::Handle & a_handle, const kernel::Name & a_name);
     void destroy( kernel::Handle & a_handle);
     void set( kernel::Handle & a_handle);
     void reset( kernel::Handle & a_handle);
@@ -119,20 +182,25 @@ namespace kernel::critical_section
     // Modyfing this outside critical_section API is UB.
     struct Context
     {
-        uint32_t        m_lockCount;
-        uint32_t        m_spinLock;
-        kernel::Handle  m_event;
-        kernel::Handle  m_ownerTask; // Debug information.
+        volatile uint32_t   m_owner;        // Index of owner task.
+        uint32_t            m_lockCount;    // Number of nested enter calls by owner task.
+        volatile uint32_t   m_waiters;
+        uint32_t            m_spinLock;
+        uint32_t            m_spinLockMax;
+        kernel::Handle      m_event;
     };
 
-    // Spinlock argument define number of ticks used to check critical section
-    // condition. Experimenting with its value can improve performance, because
-    // it can reduce number of context switches.
+    // Spinlock argument define maximum number of checks of critical section
+    // condition, before task is blocked. Actual number adapts to observed hold
+    // times, so it only bounds time wasted on spinning.
     bool init( Context & a_context, uint32_t a_spinLock = 100U);
     void deinit( Context & a_context);
 
     // Calling enter/leave without calling init first will cause UB.
+    // Owner task can enter again and must leave the same number of times. Critical section
+    // is then handed over to the highest priority waiting task.
     void enter( Context & a_context);
+    // Calling leave from task, which doesn't own critical section, is ignored.
     void leave( Context & a_context);
 }
 
@@ -146,7 +214,7 @@ namespace kernel::sync
         WaitFailed
     };
 
-    // Can wait for system objects of type: Event, Timer, Queue.
+    // Can wait for system objects of type: Event, Timer, Queue, RingBuffer, MpscQueue, QueueSet, Semaphore, RwLock.
     // NOTE: Destroying system objects used by this function will result in undefined behaviour.
     WaitResult waitForSingleObject(
         kernel::Handle &    a_handle,
@@ -168,6 +236,30 @@ namespace kernel::sync
     );
 }
 
+// Task notification API. Each task has 32-bit notification value, so signaling a known
+// task does not need any system object.
+namespace kernel::task
+{
+    // Can be used from within interrupt handler.
+    // Task waiting in notifyWait is woken up at once, or by system tick pended when
+    // interrupt handler exits.
+    bool notify(
+        kernel::Handle &                a_handle,
+        uint32_t                        a_value = 0U,
+        kernel::task::NotifyAction      a_action = kernel::task::NotifyAction::Increment
+    );
+
+    // Wait until notification value of current task is not zero. a_value returns notification
+    // value, which is then cleared, or decremented if a_clear_on_exit is not set.
+    // Note: It cannot be used from within interrupt handler!
+    kernel::sync::WaitResult notifyWait(
+        uint32_t &      a_value,
+        bool            a_clear_on_exit = true,
+        bool            a_wait_forever = true,
+        TimeMs          a_timeout = 0U
+    );
+}
+
 // Static queue API can be used from within interrupt handler.
 namespace kernel::static_queue
 {
@@ -175,37 +267,123 @@ namespace kernel::static_queue
     template < typename TType, size_t Size>
     struct Buffer
     {
-        volatile TType m_data[ Size]; // Note: Not initialized on purpose.
+        TType m_data[ Size]; // Note: Not initialized on purpose.
     };
     
-    // ap_name parameter must be pointer to compile time available literal or UB.
+    // Named queue is registered in kernel name registry. Name must be unique.
     bool create(
-        kernel::Handle &      a_handle,
-        size_t                a_data_max_size,
-        size_t                a_data_type_size,
-        volatile void * const ap_static_buffer,
-        const char * const    ap_name = nullptr
+        kernel::Handle &        a_handle,
+        size_t                  a_data_max_size,
+        size_t                  a_data_type_size,
+        void * const            ap_static_buffer,
+        const kernel::Name &    a_name = kernel::Name{}
     );
     
-    // ap_name parameter must be pointer to compile time available literal or UB.
-    bool open( kernel::Handle & a_handle, const char * const ap_name);
+    // Indexes of Typed queue. They are free running and wrapped with mask on access.
+    // Modyfing it outside queue API is UB.
+    struct TypedIndexes
+    {
+        uint32_t m_head;
+        uint32_t m_tail;
+    };
+
+    // Register Typed queue indexes in kernel, so queue can be waited for.
+    // Use Typed queue create template instead.
+    bool create(
+        kernel::Handle &        a_handle,
+        size_t                  a_data_max_size,
+        TypedIndexes &          a_typed_indexes,
+        const kernel::Name &    a_name = kernel::Name{}
+    );
+
+    // Find queue in kernel name registry. Lookup cost does not depend on number of objects.
+    bool open( kernel::Handle & a_handle, const kernel::Name & a_name);
     void destroy( kernel::Handle & a_handle);
-    bool send( kernel::Handle & a_handle, volatile void * const ap_data);
-    bool receive( kernel::Handle & a_handle, volatile void * const ap_data);
+
+    // Note: Byte-wise send and receive return false for Typed queue.
+    bool send( kernel::Handle & a_handle, const void * const ap_data);
+
+    // Push item in front of all items already in queue, so it is received next.
+    // Meant for urgent messages. Urgent items sent one after another are received in reverse order.
+    // Note: Returns false for Typed queue. Must not be used while peek is active.
+    bool sendToFront( kernel::Handle & a_handle, const void * const ap_data);
+
+    bool receive( kernel::Handle & a_handle, void * const ap_data);
     bool size( kernel::Handle & a_handle, size_t & a_size);
     bool isFull( kernel::Handle & a_handle, bool & a_is_full);
     bool isEmpty( kernel::Handle & a_handle, bool & a_is_empty);
+
+    // Blocking send and receive. Calling task waits in kernel until queue is not full
+    // (or not empty), or, if a_wait_forever is not set, a_timeout in miliseconds elapsed.
+    // Return false on timeout.
+    // Note: Cannot be used from within interrupt handler.
+    bool send( kernel::Handle & a_handle, const void * const ap_data, bool a_wait_forever, TimeMs a_timeout = 0U);
+    bool receive( kernel::Handle & a_handle, void * const ap_data, bool a_wait_forever, TimeMs a_timeout = 0U);
+
+    // Batch send and receive. Move up to a_number_of_elements elements in single critical section.
+    // Return number of elements transferred, which is smaller when queue gets full (or empty).
+    // Note: Returns 0 for Typed queue.
+    size_t sendN( kernel::Handle & a_handle, const void * const ap_data, size_t a_number_of_elements);
+    size_t receiveN( kernel::Handle & a_handle, void * const ap_data, size_t a_number_of_elements);
+
+    // Zero-copy access to queue static buffer, ie. for DMA or in place parsing.
+    // reserve return pointer to the first free element and number of contiguous free elements,
+    // which ends at the buffer end. Producer fills them directly and calls commit with number
+    // of elements written. peek and consume work the same way for the oldest elements.
+    // Return nullptr (and 0 elements) if queue is full/empty, or for Typed queue.
+    // Only one reservation and one peek can be active at a time.
+    // Can be used from within interrupt handler. Committed elements signal queue waiters.
+    void * reserve( kernel::Handle & a_handle, size_t & a_number_of_elements);
+    bool commit( kernel::Handle & a_handle, size_t a_number_of_elements);
+    const void * peek( kernel::Handle & a_handle, size_t & a_number_of_elements);
+    bool consume( kernel::Handle & a_handle, size_t a_number_of_elements);
+
+    // Wait until queue is not full. It is used by blocking send of Typed queue.
+    // To wait until queue is not empty use kernel::sync functions with queue handle.
+    kernel::sync::WaitResult waitForNotFull( kernel::Handle & a_handle, bool a_wait_forever = true, TimeMs a_timeout = 0U);
+
+    // Called by Typed queue API after elements were stored or taken. From interrupt handler
+    // it pends reschedule, so task waiting for the queue runs as soon as handler exits.
+    // Use Typed queue templates instead.
+    void notifyTypedChange();
+
+    // Signal queue waiters only when a_trigger_level elements are stored (or queue is full),
+    // so consumer is woken up once per batch, not per element. With a_batch_timeout, waiters
+    // are also signaled when unconsumed elements wait a_batch_timeout miliseconds, which bounds
+    // latency of the last elements. Timeout is measured with system tick resolution.
+    // Default trigger level is 1. Blocking receive on empty queue waits for trigger level too.
+    // Note: Queue set member is ready when it is not empty, regardless of trigger level.
+    bool setTriggerLevel( kernel::Handle & a_handle, size_t a_trigger_level);
+    bool setTriggerLevel( kernel::Handle & a_handle, size_t a_trigger_level, TimeMs a_batch_timeout);
+
+    // Queue usage statistics, ie. for sizing queue buffers from production data.
+    // Collected only when KERNEL_QUEUE_STATS_ENABLE is set, otherwise getStats returns false.
+    // Items handed off directly to blocked receiver are counted as sent and received.
+    struct Stats
+    {
+        size_t      m_peak_size{ 0U};       // Highest number of stored elements.
+        uint32_t    m_dropped_sends{ 0U};   // Elements not sent, since queue was full.
+        uint32_t    m_total_sends{ 0U};
+        uint32_t    m_total_receives{ 0U};
+        TimeMs      m_time_full{ 0U};       // Sampled with system tick resolution.
+    };
+
+    // Note: Return false for Typed queue, which is not counted.
+    bool getStats( kernel::Handle & a_handle, Stats & a_stats);
+
+    // Clear counters. Peak size starts from current size.
+    bool resetStats( kernel::Handle & a_handle);
     
     template < typename TType, size_t Size>
-    inline bool create( kernel::Handle & a_handle, Buffer< TType, Size> & a_buffer, const char * ap_name = nullptr)
+    inline bool create( kernel::Handle & a_handle, Buffer< TType, Size> & a_buffer, const kernel::Name & a_name = kernel::Name{})
     {
-        return create( a_handle, Size, sizeof( TType), &a_buffer.m_data, ap_name);
+        return create( a_handle, Size, sizeof( TType), &a_buffer.m_data, a_name);
     }
 
     template < typename TType>
-    inline bool send( kernel::Handle & a_handle, TType & a_data)
+    inline bool send( kernel::Handle & a_handle, const TType & a_data)
     {
-        return send( a_handle, &a_data);
+        return send( a_handle, static_cast< const void *>( &a_data));
     }
 
     template < typename TType>
@@ -213,6 +391,461 @@ namespace kernel::static_queue
     {
         return receive( a_handle, &a_data);
     }
+
+    template < typename TType>
+    inline bool sendToFront( kernel::Handle & a_handle, const TType & a_data)
+    {
+        return sendToFront( a_handle, static_cast< const void *>( &a_data));
+    }
+
+    // Element type must be the same as type used to create the queue or UB.
+    template < typename TType>
+    inline size_t sendN( kernel::Handle & a_handle, const TType * const ap_data, size_t a_number_of_elements)
+    {
+        return sendN( a_handle, static_cast< const void *>( ap_data), a_number_of_elements);
+    }
+
+    template < typename TType>
+    inline size_t receiveN( kernel::Handle & a_handle, TType * const ap_data, size_t a_number_of_elements)
+    {
+        return receiveN( a_handle, static_cast< void *>( ap_data), a_number_of_elements);
+    }
+
+    template < typename TType, size_t Size>
+    inline size_t sendN( kernel::Handle & a_handle, const TType ( &a_data)[ Size])
+    {
+        return sendN( a_handle, static_cast< const void *>( a_data), Size);
+    }
+
+    template < typename TType, size_t Size>
+    inline size_t receiveN( kernel::Handle & a_handle, TType ( &a_data)[ Size])
+    {
+        return receiveN( a_handle, static_cast< void *>( a_data), Size);
+    }
+
+    // Element type must be the same as type used to create the queue or UB.
+    template < typename TType>
+    inline TType * reserve( kernel::Handle & a_handle, size_t & a_number_of_elements)
+    {
+        return static_cast< TType *>( reserve( a_handle, a_number_of_elements));
+    }
+
+    template < typename TType>
+    inline const TType * peek( kernel::Handle & a_handle, size_t & a_number_of_elements)
+    {
+        return static_cast< const TType *>( peek( a_handle, a_number_of_elements));
+    }
+
+    template < typename TType>
+    inline bool send( kernel::Handle & a_handle, const TType & a_data, bool a_wait_forever, TimeMs a_timeout = 0U)
+    {
+        return send( a_handle, static_cast< const void *>( &a_data), a_wait_forever, a_timeout);
+    }
+
+    template < typename TType>
+    inline bool receive( kernel::Handle & a_handle, TType & a_data, bool a_wait_forever, TimeMs a_timeout = 0U)
+    {
+        return receive( a_handle, static_cast< void *>( &a_data), a_wait_forever, a_timeout);
+    }
+}
+
+// Lock-free ring buffer API for passing data from a single producer to a single consumer,
+// ie. from hardware interrupt to task. Send and receive never disable interrupts.
+// Only one context can send and only one context can receive at a time, otherwise UB.
+// Consumer task can wait for ring buffer with waitForObject functions, until it is not empty.
+// Note: create and destroy cannot be used from within interrupt handler.
+namespace kernel::ring_buffer
+{
+    // Static memory buffer. Modyfing it outside ring buffer API is UB.
+    template < typename TType, size_t Size>
+    struct Buffer
+    {
+        static_assert( ( Size > 0U) && ( 0U == ( Size & ( Size - 1U))), "Ring buffer size must be a power of two!");
+
+        TType m_data[ Size]; // Note: Not initialized on purpose.
+    };
+
+    // a_data_max_size must be a power of two.
+    bool create(
+        kernel::Handle &      a_handle,
+        size_t                a_data_max_size,
+        size_t                a_data_type_size,
+        void * const          ap_static_buffer
+    );
+
+    void destroy( kernel::Handle & a_handle);
+    bool send( kernel::Handle & a_handle, const void * const ap_data);
+    bool receive( kernel::Handle & a_handle, void * const ap_data);
+    bool size( kernel::Handle & a_handle, size_t & a_size);
+
+    template < typename TType, size_t Size>
+    inline bool create( kernel::Handle & a_handle, Buffer< TType, Size> & a_buffer)
+    {
+        return create( a_handle, Size, sizeof( TType), &a_buffer.m_data);
+    }
+
+    template < typename TType>
+    inline bool send( kernel::Handle & a_handle, const TType & a_data)
+    {
+        return send( a_handle, static_cast< const void *>( &a_data));
+    }
+
+    template < typename TType>
+    inline bool receive( kernel::Handle & a_handle, TType & a_data)
+    {
+        return receive( a_handle, static_cast< void *>( &a_data));
+    }
+}
+
+// Lock-free multiple producers, single consumer queue API for passing data from many hardware
+// interrupts, of any priority, to a single task. Send never disables interrupts, producers
+// claim slots with exclusive load/store instead. Any number of contexts can send at a time,
+// but only one context can receive, otherwise UB.
+// Consumer task can wait for MPSC queue with waitForObject functions, until it is not empty.
+// Note: Item sent by interrupted producer blocks receiving of newer items, until that producer
+//       resumes and finishes its send.
+// Note: create and destroy cannot be used from within interrupt handler.
+namespace kernel::mpsc_queue
+{
+    // Static memory buffer. Modyfing it outside MPSC queue API is UB.
+    template < typename TType, size_t Size>
+    struct Buffer
+    {
+        static_assert( ( Size > 0U) && ( 0U == ( Size & ( Size - 1U))), "MPSC queue size must be a power of two!");
+
+        volatile uint32_t   m_sequences[ Size]; // Note: Initialized by create.
+        TType               m_data[ Size];      // Note: Not initialized on purpose.
+    };
+
+    // a_data_max_size must be a power of two. ap_sequences must point to a_data_max_size words.
+    bool create(
+        kernel::Handle &            a_handle,
+        size_t                      a_data_max_size,
+        size_t                      a_data_type_size,
+        void * const                ap_static_buffer,
+        volatile uint32_t * const   ap_sequences
+    );
+
+    void destroy( kernel::Handle & a_handle);
+    bool send( kernel::Handle & a_handle, const void * const ap_data);
+    bool receive( kernel::Handle & a_handle, void * const ap_data);
+    bool size( kernel::Handle & a_handle, size_t & a_size);
+
+    template < typename TType, size_t Size>
+    inline bool create( kernel::Handle & a_handle, Buffer< TType, Size> & a_buffer)
+    {
+        return create( a_handle, Size, sizeof( TType), &a_buffer.m_data, a_buffer.m_sequences);
+    }
+
+    template < typename TType>
+    inline bool send( kernel::Handle & a_handle, const TType & a_data)
+    {
+        return send( a_handle, static_cast< const void *>( &a_data));
+    }
+
+    template < typename TType>
+    inline bool receive( kernel::Handle & a_handle, TType & a_data)
+    {
+        return receive( a_handle, static_cast< void *>( &a_data));
+    }
+}
+
+// Priority message queue API. Each message carries priority and receive always return
+// the highest priority message. Messages of the same priority are received in FIFO order.
+// Messages are kept in bounded binary heap, so send and receive take O(log n) steps.
+// Can be used from within interrupt handler, except create and destroy.
+// Task can wait for priority queue with waitForObject functions, until it is not empty.
+namespace kernel::priority_queue
+{
+    // Higher value means more urgent message.
+    typedef uint8_t Priority;
+
+    // Heap entry pointing to message slot in static buffer.
+    // Modyfing it outside priority queue API is UB.
+    struct Entry
+    {
+        uint32_t m_sequence;
+        uint16_t m_slot;
+        uint16_t m_priority;
+    };
+
+    // Static memory buffer. Modyfing it outside priority queue API is UB.
+    template < typename TType, size_t Size>
+    struct Buffer
+    {
+        static_assert( ( Size > 0U) && ( Size <= 0x1'0000U), "Priority queue size must fit in Entry slot index!");
+
+        TType m_data[ Size];        // Note: Not initialized on purpose.
+        Entry m_entries[ Size];
+    };
+
+    bool create(
+        kernel::Handle &      a_handle,
+        size_t                a_data_max_size,
+        size_t                a_data_type_size,
+        void * const          ap_static_buffer,
+        Entry * const         ap_entries
+    );
+
+    void destroy( kernel::Handle & a_handle);
+    bool send( kernel::Handle & a_handle, const void * const ap_data, Priority a_priority);
+
+    // Message is received before any other message, regardless of their priority.
+    // Urgent messages sent one after another are received in reverse order.
+    bool sendToFront( kernel::Handle & a_handle, const void * const ap_data);
+
+    // ap_priority is optional and receive priority of the message.
+    // Message sent with sendToFront has the highest Priority value.
+    bool receive( kernel::Handle & a_handle, void * const ap_data, Priority * const ap_priority = nullptr);
+    bool size( kernel::Handle & a_handle, size_t & a_size);
+
+    template < typename TType, size_t Size>
+    inline bool create( kernel::Handle & a_handle, Buffer< TType, Size> & a_buffer)
+    {
+        return create( a_handle, Size, sizeof( TType), &a_buffer.m_data, a_buffer.m_entries);
+    }
+
+    template < typename TType>
+    inline bool send( kernel::Handle & a_handle, const TType & a_data, Priority a_priority)
+    {
+        return send( a_handle, static_cast< const void *>( &a_data), a_priority);
+    }
+
+    template < typename TType>
+    inline bool sendToFront( kernel::Handle & a_handle, const TType & a_data)
+    {
+        return sendToFront( a_handle, static_cast< const void *>( &a_data));
+    }
+
+    template < typename TType>
+    inline bool receive( kernel::Handle & a_handle, TType & a_data, Priority * const ap_priority = nullptr)
+    {
+        return receive( a_handle, static_cast< void *>( &a_data), ap_priority);
+    }
+}
+
+// Stream buffer API for byte streams, ie. serial data. Any number of bytes can be sent
+// and received by single call. Bytes are copied in at most two blocks around buffer end.
+// Task can wait for stream buffer with waitForObject functions. It is signaled when at least
+// trigger level bytes are stored, or when it is full.
+// Can be used from within interrupt handler, except create and destroy.
+namespace kernel::stream_buffer
+{
+    // Static memory buffer. Modyfing it outside stream or message buffer API is UB.
+    template < size_t Size>
+    struct Buffer
+    {
+        uint8_t m_data[ Size]; // Note: Not initialized on purpose.
+    };
+
+    // a_trigger_level must be in range from 1 to a_data_max_size.
+    bool create(
+        kernel::Handle &      a_handle,
+        size_t                a_data_max_size,
+        void * const          ap_static_buffer,
+        size_t                a_trigger_level = 1U
+    );
+
+    void destroy( kernel::Handle & a_handle);
+
+    // Return number of bytes sent (or received), which is smaller when buffer gets full (or empty).
+    size_t send( kernel::Handle & a_handle, const void * const ap_data, size_t a_number_of_bytes);
+    size_t receive( kernel::Handle & a_handle, void * const ap_data, size_t a_number_of_bytes);
+
+    // Blocking send. Calling task waits in kernel while buffer is full, until all bytes are sent
+    // or, if a_wait_forever is not set, a_timeout in miliseconds elapsed. Return number of bytes sent.
+    // Note: Cannot be used from within interrupt handler.
+    size_t send(
+        kernel::Handle &    a_handle,
+        const void * const  ap_data,
+        size_t              a_number_of_bytes,
+        bool                a_wait_forever,
+        TimeMs              a_timeout = 0U
+    );
+
+    // Wait until buffer is not full. Writer is woken up as soon as reader, ie. interrupt handler,
+    // frees space, so it can send the rest of its data without polling.
+    kernel::sync::WaitResult waitForNotFull( kernel::Handle & a_handle, bool a_wait_forever = true, TimeMs a_timeout = 0U);
+
+    bool size( kernel::Handle & a_handle, size_t & a_size);
+    bool setTriggerLevel( kernel::Handle & a_handle, size_t a_trigger_level);
+
+    template < size_t Size>
+    inline bool create( kernel::Handle & a_handle, Buffer< Size> & a_buffer, size_t a_trigger_level = 1U)
+    {
+        return create( a_handle, Size, &a_buffer.m_data, a_trigger_level);
+    }
+
+    // Send string without end-of-string sign.
+    template < size_t Size>
+    inline size_t send( kernel::Handle & a_handle, const char ( &a_string)[ Size])
+    {
+        return send( a_handle, static_cast< const void *>( a_string), Size - 1U);
+    }
+
+    template < typename TType, size_t Size>
+    inline size_t receive( kernel::Handle & a_handle, TType ( &a_data)[ Size])
+    {
+        static_assert( 1U == sizeof( TType), "Stream buffer element must be a single byte!");
+
+        return receive( a_handle, static_cast< void *>( a_data), Size);
+    }
+}
+
+// Message buffer API for variable size messages. Each message is stored with 2 byte length
+// prefix in single contiguous ring, so it is received whole, the same way it was sent.
+// Message length is limited to 65535 bytes.
+// Task can wait for message buffer with waitForObject functions. It is signaled when at least
+// trigger level bytes of messages (without prefixes) are stored, or when it is full.
+// Can be used from within interrupt handler, except create and destroy.
+namespace kernel::message_buffer
+{
+    template < size_t Size>
+    using Buffer = kernel::stream_buffer::Buffer< Size>;
+
+    // a_trigger_level must be in range from 1 to a_data_max_size.
+    bool create(
+        kernel::Handle &      a_handle,
+        size_t                a_data_max_size,
+        void * const          ap_static_buffer,
+        size_t                a_trigger_level = 1U
+    );
+
+    void destroy( kernel::Handle & a_handle);
+
+    // Return false if message with its prefix does not fit in free space.
+    bool send( kernel::Handle & a_handle, const void * const ap_data, size_t a_length);
+
+    // Return length of received message. Return 0 if there is no message or it is longer
+    // than a_max_length. In the second case message is left in buffer, see nextLength.
+    size_t receive( kernel::Handle & a_handle, void * const ap_data, size_t a_max_length);
+
+    // Length of the oldest message, or 0 if buffer is empty.
+    bool nextLength( kernel::Handle & a_handle, size_t & a_length);
+    bool setTriggerLevel( kernel::Handle & a_handle, size_t a_trigger_level);
+
+    template < size_t Size>
+    inline bool create( kernel::Handle & a_handle, Buffer< Size> & a_buffer, size_t a_trigger_level = 1U)
+    {
+        return create( a_handle, Size, &a_buffer.m_data, a_trigger_level);
+    }
+
+    template < typename TType>
+    inline bool send( kernel::Handle & a_handle, const TType & a_message)
+    {
+        return send( a_handle, static_cast< const void *>( &a_message), sizeof( TType));
+    }
+
+    template < typename TType, size_t Size>
+    inline size_t receive( kernel::Handle & a_handle, TType ( &a_data)[ Size])
+    {
+        return receive( a_handle, static_cast< void *>( a_data), sizeof( a_data));
+    }
+}
+
+// Queue set API for waiting on many static queues and events at once, without
+// waitForMultipleObjects limit of handles. Member, which becomes ready (item is sent to queue
+// or event is set), is appended to ready FIFO of its set, so task learns which one is ready
+// without testing all of them.
+// Task can wait for queue set with waitForObject functions. It is signaled when any member
+// is ready. Member drained without select (ie. queue emptied by direct receive) does not
+// signal the set anymore.
+namespace kernel::queue_set
+{
+    bool create( kernel::Handle & a_handle);
+
+    // Members are released, but not destroyed.
+    void destroy( kernel::Handle & a_handle);
+
+    // Member can be byte-wise static queue or event. Typed queues are not supported.
+    // Member can belong to one set at a time. Destroyed member leaves its set.
+    bool add( kernel::Handle & a_handle, kernel::Handle & a_member);
+    bool remove( kernel::Handle & a_handle, kernel::Handle & a_member);
+
+    // Return the oldest ready member in a_member. Queue item is not received, so use
+    // non-blocking static_queue::receive on selected queue. Selected auto reset event is reset.
+    // Queue, which still holds items, is selected again on later calls.
+    // Note: Only one task should select from the same set.
+    bool select( kernel::Handle & a_handle, kernel::Handle & a_member);
+    // Blocking select. Wait for ready member, or, if a_wait_forever is not set, until a_timeout elapses.
+    bool select( kernel::Handle & a_handle, kernel::Handle & a_member, bool a_wait_forever, TimeMs a_timeout = 0U);
+}
+
+// Event group API. Single group holds 32 event flags.
+// Set, clear and get can be used from within interrupt handler.
+namespace kernel::event_group
+{
+    bool create( kernel::Handle & a_handle);
+    void destroy( kernel::Handle & a_handle);
+
+    // Return group flags after they were set.
+    uint32_t set( kernel::Handle & a_handle, uint32_t a_flags);
+
+    // Return group flags before they were cleared.
+    uint32_t clear( kernel::Handle & a_handle, uint32_t a_flags);
+    uint32_t get( kernel::Handle & a_handle);
+
+    // Wait until any (or all, if a_wait_for_all is set) of a_mask flags are set.
+    // a_flags returns group flags at the moment wait condition was met (or timeout occurred).
+    // If a_clear_on_exit is set, a_mask flags are cleared when wait condition is met.
+    // Note: It cannot be used from within interrupt handler!
+    kernel::sync::WaitResult wait(
+        kernel::Handle &    a_handle,
+        uint32_t            a_mask,
+        uint32_t &          a_flags,
+        bool                a_wait_for_all = false,
+        bool                a_clear_on_exit = true,
+        bool                a_wait_forever = true,
+        TimeMs              a_timeout = 0U
+    );
+}
+
+// Counting semaphore API. Give and non-blocking take can be used from within interrupt handler.
+namespace kernel::semaphore
+{
+    bool create( kernel::Handle & a_handle, uint32_t a_max_count, uint32_t a_initial_count = 0U);
+    void destroy( kernel::Handle & a_handle);
+
+    // Return 'false' if count already reached its maximum.
+    bool give( kernel::Handle & a_handle);
+
+    // Return 'false' if count is zero. Scheduler is not entered.
+    bool take( kernel::Handle & a_handle);
+
+    // Wait until count is positive, or, if a_wait_forever is not set, until a_timeout elapses.
+    // Note: It cannot be used from within interrupt handler!
+    bool take( kernel::Handle & a_handle, bool a_wait_forever, TimeMs a_timeout = 0U);
+
+    bool count( kernel::Handle & a_handle, uint32_t & a_count);
+}
+
+// Reader-writer lock API. Lock is held by any number of readers or by single writer,
+// so readers never block each other. Lock is not recursive.
+// Non-blocking lock and unlock functions can be used from within interrupt handler.
+namespace kernel::rw_lock
+{
+    enum class Policy
+    {
+        // New readers wait while writer waits, so writers are not starved.
+        PreferWriter,
+        // Readers wait only while lock is written.
+        PreferReader
+    };
+
+    bool create( kernel::Handle & a_handle, Policy a_policy = Policy::PreferWriter);
+    void destroy( kernel::Handle & a_handle);
+
+    // Return 'false' if lock can't be taken at once. Scheduler is not entered.
+    bool tryLockRead( kernel::Handle & a_handle);
+    bool tryLockWrite( kernel::Handle & a_handle);
+
+    // Wait until lock is taken or timeout elapses.
+    // Note: It cannot be used from within interrupt handler!
+    bool lockRead( kernel::Handle & a_handle, bool a_wait_forever = true, TimeMs a_timeout = 0U);
+    bool lockWrite( kernel::Handle & a_handle, bool a_wait_forever = true, TimeMs a_timeout = 0U);
+
+    void unlockRead( kernel::Handle & a_handle);
+    void unlockWrite( kernel::Handle & a_handle);
 }
 
 namespace kernel::hardware
@@ -294,3 +927,227 @@ namespace kernel::hardware
         void setBreakpoint();
     }
 }
+
+// Static queue with element type and capacity known at compile time.
+// Typed queue API can be used from within interrupt handler.
+namespace kernel::static_queue
+{
+    // Must be the same as internal static queue critical section priority.
+    constexpr auto typed_critical_section_priority{ hardware::interrupt::priority::Preemption::Kernel};
+
+    // Capacity must be a power of two, so index wrap-around is a mask and
+    // elements are copied with typed assignment.
+    // Use m_handle to wait for queue not empty with waitForObject functions.
+    // Modyfing it outside queue API is UB.
+    // Note: Typed queue is accessed without kernel, so it has no direct handoff to waiting
+    //       receiver, trigger level or statistics. Task sending or receiving from thread mode
+    //       wakes waiters on the next system tick.
+    // Note: Hardware critical section is not inlined, since BASEPRI access is kept in hardware
+    //       layer. Each access costs its enter and leave calls, and notifyTypedChange call,
+    //       if queue changed. Use examples/queue_benchmark to see their cycles on target.
+    template < typename TType, size_t Size>
+    struct Typed
+    {
+        static_assert( ( Size > 0U) && ( 0U == ( Size & ( Size - 1U))), "Typed queue size must be a power of two!");
+
+        typedef TType Type;
+
+        kernel::Handle  m_handle;
+        TypedIndexes    m_indexes;
+        TType           m_data[ Size]; // Note: Not initialized on purpose.
+    };
+
+    template < typename TType, size_t Size>
+    inline bool create( Typed< TType, Size> & a_queue, const kernel::Name & a_name = kernel::Name{})
+    {
+        return create( a_queue.m_handle, Size, a_queue.m_indexes, a_name);
+    }
+
+    template < typename TType, size_t Size>
+    inline void destroy( Typed< TType, Size> & a_queue)
+    {
+        destroy( a_queue.m_handle);
+    }
+
+    template < typename TType, size_t Size>
+    inline bool send( Typed< TType, Size> & a_queue, const typename Typed< TType, Size>::Type & a_data)
+    {
+        {
+            hardware::CriticalSection critical_section{ typed_critical_section_priority};
+
+            const uint32_t head = a_queue.m_indexes.m_head;
+
+            if ( ( head - a_queue.m_indexes.m_tail) >= Size)
+            {
+                return false;
+            }
+
+            a_queue.m_data[ head & ( Size - 1U)] = a_data;
+            a_queue.m_indexes.m_head = head + 1U;
+        }
+
+        notifyTypedChange();
+
+        return true;
+    }
+
+    template < typename TType, size_t Size>
+    inline bool receive( Typed< TType, Size> & a_queue, typename Typed< TType, Size>::Type & a_data)
+    {
+        {
+            hardware::CriticalSection critical_section{ typed_critical_section_priority};
+
+            const uint32_t tail = a_queue.m_indexes.m_tail;
+
+            if ( a_queue.m_indexes.m_head == tail)
+            {
+                return false;
+            }
+
+            a_data = a_queue.m_data[ tail & ( Size - 1U)];
+            a_queue.m_indexes.m_tail = tail + 1U;
+        }
+
+        notifyTypedChange();
+
+        return true;
+    }
+
+    // Typed batch send. Return number of elements sent.
+    template < typename TType, size_t Size>
+    inline size_t sendN(
+        Typed< TType, Size> &                       a_queue,
+        const typename Typed< TType, Size>::Type *  ap_data,
+        size_t                                      a_number_of_elements
+    )
+    {
+        size_t elements_to_send;
+
+        {
+            hardware::CriticalSection critical_section{ typed_critical_section_priority};
+
+            uint32_t head = a_queue.m_indexes.m_head;
+            const size_t free_elements = Size - ( head - a_queue.m_indexes.m_tail);
+            elements_to_send = ( a_number_of_elements < free_elements) ? a_number_of_elements : free_elements;
+
+            for ( size_t i = 0U; i < elements_to_send; ++i, ++head)
+            {
+                a_queue.m_data[ head & ( Size - 1U)] = ap_data[ i];
+            }
+
+            a_queue.m_indexes.m_head = head;
+        }
+
+        if ( elements_to_send > 0U)
+        {
+            notifyTypedChange();
+        }
+
+        return elements_to_send;
+    }
+
+    // Typed batch receive. Return number of elements received.
+    template < typename TType, size_t Size>
+    inline size_t receiveN(
+        Typed< TType, Size> &                       a_queue,
+        typename Typed< TType, Size>::Type *        ap_data,
+        size_t                                      a_number_of_elements
+    )
+    {
+        size_t elements_to_receive;
+
+        {
+            hardware::CriticalSection critical_section{ typed_critical_section_priority};
+
+            uint32_t tail = a_queue.m_indexes.m_tail;
+            const size_t used_elements = a_queue.m_indexes.m_head - tail;
+            elements_to_receive = ( a_number_of_elements < used_elements) ? a_number_of_elements : used_elements;
+
+            for ( size_t i = 0U; i < elements_to_receive; ++i, ++tail)
+            {
+                ap_data[ i] = a_queue.m_data[ tail & ( Size - 1U)];
+            }
+
+            a_queue.m_indexes.m_tail = tail;
+        }
+
+        if ( elements_to_receive > 0U)
+        {
+            notifyTypedChange();
+        }
+
+        return elements_to_receive;
+    }
+
+    // Blocking typed send. Return false on timeout.
+    // Note: Cannot be used from within interrupt handler.
+    template < typename TType, size_t Size>
+    inline bool send(
+        Typed< TType, Size> &                       a_queue,
+        const typename Typed< TType, Size>::Type &  a_data,
+        bool                                        a_wait_forever,
+        TimeMs                                      a_timeout = 0U
+    )
+    {
+        const TimeMs start_time = kernel::getTime();
+
+        while ( false == send( a_queue, a_data))
+        {
+            const TimeMs elapsed_time = kernel::getTime() - start_time;
+
+            if ( ( false == a_wait_forever) && ( elapsed_time >= a_timeout))
+            {
+                return false;
+            }
+
+            const TimeMs remaining_time = ( true == a_wait_forever) ? 0U : a_timeout - elapsed_time;
+
+            if ( sync::WaitResult::ObjectSet != waitForNotFull( a_queue.m_handle, a_wait_forever, remaining_time))
+            {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    // Blocking typed receive. Return false on timeout.
+    // Note: Cannot be used from within interrupt handler.
+    template < typename TType, size_t Size>
+    inline bool receive(
+        Typed< TType, Size> &                       a_queue,
+        typename Typed< TType, Size>::Type &        a_data,
+        bool                                        a_wait_forever,
+        TimeMs                                      a_timeout = 0U
+    )
+    {
+        const TimeMs start_time = kernel::getTime();
+
+        while ( false == receive( a_queue, a_data))
+        {
+            const TimeMs elapsed_time = kernel::getTime() - start_time;
+
+            if ( ( false == a_wait_forever) && ( elapsed_time >= a_timeout))
+            {
+                return false;
+            }
+
+            const TimeMs remaining_time = ( true == a_wait_forever) ? 0U : a_timeout - elapsed_time;
+
+            if ( sync::WaitResult::ObjectSet != sync::waitForSingleObject( a_queue.m_handle, a_wait_forever, remaining_time))
+            {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    template < typename TType, size_t Size>
+    inline size_t size( Typed< TType, Size> & a_queue)
+    {
+        hardware::CriticalSection critical_section{ typed_critical_section_priority};
+
+        return a_queue.m_indexes.m_head - a_queue.m_indexes.m_tail;
+    }
+}
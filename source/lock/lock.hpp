@@ -1,33 +1,90 @@
 #pragma once
 
+#include "hardware/hardware.hpp"
+
 #ifndef __GNUC__
 // Workaround for nano lib issues with GCC and atomic
 #include <atomic>
 #endif
 
 // Kernel level critical section between thread and handler modes.
-// todo: re-work
+
+// Kernel data is plain memory and it is only accessed while lock is taken, or from
+// handler mode. Lock boundaries are compiler barriers, so compiler cannot move kernel
+// data accesses outside of the lock, but it is free to optimize accesses inside it.
+// Note: Single core only. CPU does not re-order its own memory accesses, so no DMB is needed.
+
+// Lock count is changed with LDREX/STREX, so nested enter and leave are atomic in respect
+// to interrupts. Scheduling work of tick, which came while lock was taken, is deferred:
+// tick only keeps time and marks itself pending, and leave of the outermost lock pends
+// tick again at once, so no wake up or task switch is lost.
 namespace kernel::internal::lock
 {
     struct Context
+    {
+        volatile uint32_t   m_interlock{ 0U};
+        volatile bool       m_is_tick_pending{ false};
+    };
+
+    inline void compilerBarrier()
     {
         #ifndef __GNUC__
-            std::atomic< uint32_t> m_interlock{ 0U };
+            std::atomic_signal_fence( std::memory_order_seq_cst);
         #else
-            volatile uint32_t m_interlock{ 0U };
+            __asm__ volatile( "" ::: "memory");
         #endif
-    };
+    }
 
     inline bool isLocked( Context & a_context)
     {
-        return ( 0U == a_context.m_interlock);
+        return ( 0U != a_context.m_interlock);
     }
+
     inline void enter( Context & a_context)
     {
-        ++a_context.m_interlock;
+        uint32_t interlock;
+
+        do
+        {
+            interlock = a_context.m_interlock;
+        }
+        while ( false == hardware::utility::compareAndSwap( a_context.m_interlock, interlock, interlock + 1U));
+
+        compilerBarrier();
     }
+
     inline void leave( Context & a_context)
     {
-        --a_context.m_interlock;
+        compilerBarrier();
+
+        uint32_t interlock;
+
+        do
+        {
+            interlock = a_context.m_interlock;
+        }
+        while ( false == hardware::utility::compareAndSwap( a_context.m_interlock, interlock, interlock - 1U));
+
+        if ( ( 1U == interlock) && ( true == a_context.m_is_tick_pending))
+        {
+            hardware::pendReschedule();
+        }
+    }
+
+    // Called by tick, which came while lock was taken.
+    inline void deferTick( Context & a_context)
+    {
+        a_context.m_is_tick_pending = true;
+    }
+
+    // Called by tick, when lock is free. Return 'true' if scheduling work of previous tick
+    // was deferred.
+    inline bool takeDeferredTick( Context & a_context)
+    {
+        const bool is_tick_pending = a_context.m_is_tick_pending;
+
+        a_context.m_is_tick_pending = false;
+
+        return is_tick_pending;
     }
 }
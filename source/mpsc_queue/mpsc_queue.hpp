@@ -0,0 +1,222 @@
+#pragma once
+
+#include "config/config.hpp"
+#include "common/memory_buffer.hpp"
+#include "common/memory.hpp"
+#include "hardware/hardware.hpp"
+
+#include "../kernel.hpp"
+
+// Lock-free multiple producers, single consumer queue implementation.
+
+// Queue main usage is data transfer from many hardware interrupts of different priorities to
+// a single task. Producers claim slot by compare and swap of m_head and publish it by writing
+// slot sequence number, so send never enters critical section and interrupts are never masked.
+
+// Each slot has sequence number, which tells its state for given position:
+// - sequence == position: slot is free and can be claimed by producer,
+// - sequence == position + 1: slot is published and can be received by consumer.
+// Consumer releases slot for the next round by setting its sequence to position + capacity.
+
+// Slot claimed by preempted producer is not received until it is published, even if newer
+// slots already are. Queue then looks empty to consumer, so it should be sized for the worst
+// case burst.
+
+// Positions are free running and are wrapped with mask on access, so capacity must be a
+// power of two.
+
+// Note: Only create and destroy modify queue Context and these are called from task with
+//       kernel lock taken.
+namespace kernel::internal::mpsc_queue
+{
+    // Type strong index of MPSC Queue.
+    enum class Id : uint32_t{};
+
+    struct MpscQueue
+    {
+        volatile uint32_t   m_head{ 0U}; // Claimed by producers with compare and swap.
+        volatile uint32_t   m_tail{ 0U}; // Written only by consumer.
+
+        uint32_t            m_mask{ 0U};
+        size_t              m_data_type_size{ 0U};
+        uint8_t *           mp_data{ nullptr};
+        volatile uint32_t * mp_sequences{ nullptr};
+    };
+
+    // Type strong memory index for allocated MPSC Queue type.
+    typedef common::MemoryBuffer< MpscQueue, max_number>::Id MemoryBufferIndex;
+
+    struct Context
+    {
+        common::MemoryBuffer< MpscQueue, max_number> m_data{};
+    };
+
+    // Return 'true' if a_value is a power of two.
+    constexpr bool isPowerOfTwo( size_t a_value)
+    {
+        return ( 0U != a_value) && ( 0U == ( a_value & ( a_value - 1U)));
+    }
+
+    // Signed distance of free running positions, so it is valid after wrap around.
+    inline int32_t getDistance( uint32_t a_from, uint32_t a_to)
+    {
+        return static_cast< int32_t>( a_to - a_from);
+    }
+
+    inline bool create(
+        Context &                   a_context,
+        Id &                        a_id,
+        size_t                      a_data_max_elements,
+        size_t                      a_data_type_size,
+        void * const                ap_static_buffer,
+        volatile uint32_t * const   ap_sequences
+    )
+    {
+        assert( nullptr != ap_static_buffer);
+        assert( nullptr != ap_sequences);
+        assert( isPowerOfTwo( a_data_max_elements));
+
+        MemoryBufferIndex new_queue_id;
+
+        if ( false == a_context.m_data.allocate( new_queue_id))
+        {
+            return false;
+        }
+
+        a_id = static_cast< Id>( new_queue_id);
+
+        MpscQueue & new_queue = a_context.m_data.at( new_queue_id);
+
+        new_queue.m_head = 0U;
+        new_queue.m_tail = 0U;
+
+        new_queue.m_mask = static_cast< uint32_t>( a_data_max_elements - 1U);
+        new_queue.m_data_type_size = a_data_type_size;
+        new_queue.mp_data = reinterpret_cast< uint8_t *>( ap_static_buffer);
+        new_queue.mp_sequences = ap_sequences;
+
+        for ( uint32_t position = 0U; position < a_data_max_elements; ++position)
+        {
+            new_queue.mp_sequences[ position] = position;
+        }
+
+        // Slots must be initialized before queue is used by other contexts.
+        hardware::utility::memoryBarrier();
+
+        return true;
+    }
+
+    inline void destroy( Context & a_context, Id & a_id)
+    {
+        a_context.m_data.free( static_cast< MemoryBufferIndex>( a_id));
+    }
+
+    // Note: Result of getSize and isEmpty is only a snapshot. Size counts claimed slots,
+    //       which are not yet published too.
+    inline size_t getSize( Context & a_context, Id & a_id)
+    {
+        MpscQueue & queue = a_context.m_data.at( static_cast< MemoryBufferIndex>( a_id));
+
+        return queue.m_head - queue.m_tail;
+    }
+
+    // Return 'true' if there is no published slot to receive.
+    inline bool isEmpty( Context & a_context, Id & a_id)
+    {
+        MpscQueue & queue = a_context.m_data.at( static_cast< MemoryBufferIndex>( a_id));
+
+        const uint32_t tail = queue.m_tail;
+
+        return ( ( tail + 1U) != queue.mp_sequences[ tail & queue.m_mask]);
+    }
+
+    // Push item to the head. Can be called by any number of producers at the same time.
+    inline bool send( Context & a_context, Id & a_id, const void * const ap_data)
+    {
+        assert( nullptr != ap_data);
+
+        MpscQueue & queue = a_context.m_data.at( static_cast< MemoryBufferIndex>( a_id));
+
+        uint32_t head = queue.m_head;
+
+        while ( true)
+        {
+            // Sequence must not be loaded before head.
+            hardware::utility::memoryBarrier();
+
+            const uint32_t sequence = queue.mp_sequences[ head & queue.m_mask];
+            const int32_t distance = getDistance( head, sequence);
+
+            if ( 0 == distance)
+            {
+                if ( true == hardware::utility::compareAndSwap( queue.m_head, head, head + 1U))
+                {
+                    break;
+                }
+            }
+            else if ( distance < 0)
+            {
+                // Slot was not yet released by consumer.
+                return false;
+            }
+
+            // Other producer claimed this position or store was interrupted.
+            head = queue.m_head;
+        }
+
+        // Element must not be stored before sequence, which released the slot.
+        hardware::utility::memoryBarrier();
+
+        {
+            const size_t real_head_offset = queue.m_data_type_size * ( head & queue.m_mask);
+
+            uint8_t & destination = *( queue.mp_data + real_head_offset);
+            auto & source = *reinterpret_cast< const uint8_t *>( ap_data);
+
+            memory::copy( destination, source, queue.m_data_type_size);
+        }
+
+        // Element must be stored before it is published to consumer.
+        hardware::utility::memoryBarrier();
+
+        queue.mp_sequences[ head & queue.m_mask] = head + 1U;
+
+        return true;
+    }
+
+    // Pop item from the tail. Must only be called by consumer.
+    inline bool receive( Context & a_context, Id & a_id, void * const ap_data)
+    {
+        assert( nullptr != ap_data);
+
+        MpscQueue & queue = a_context.m_data.at( static_cast< MemoryBufferIndex>( a_id));
+
+        const uint32_t tail = queue.m_tail;
+        const uint32_t slot = tail & queue.m_mask;
+
+        if ( ( tail + 1U) != queue.mp_sequences[ slot])
+        {
+            return false;
+        }
+
+        // Element must not be loaded before sequence, which published it.
+        hardware::utility::memoryBarrier();
+
+        {
+            const size_t real_tail_offset = queue.m_data_type_size * slot;
+
+            auto & destination = *reinterpret_cast< uint8_t *>( ap_data);
+            const uint8_t & source = *( queue.mp_data + real_tail_offset);
+
+            memory::copy( destination, source, queue.m_data_type_size);
+        }
+
+        // Element must be loaded before its slot is released to producers.
+        hardware::utility::memoryBarrier();
+
+        queue.mp_sequences[ slot] = tail + queue.m_mask + 1U;
+        queue.m_tail = tail + 1U;
+
+        return true;
+    }
+}
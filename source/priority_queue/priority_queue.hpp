@@ -0,0 +1,274 @@
+#pragma once
+
+#include "config/config.hpp"
+#include "common/memory_buffer.hpp"
+#include "common/memory.hpp"
+
+#include "../kernel.hpp"
+
+// Priority message queue implementation.
+
+// Messages are stored in static buffer slots and are ordered by bounded binary heap of
+// Entries (priority, sequence, slot). Only Entries are moved while heap is restored, so
+// message is copied once on send and once on receive, regardless of heap depth.
+// Entries behind the heap hold indexes of free slots.
+
+// Sequence number keeps FIFO order of messages with the same priority. It is compared by
+// difference, so its wrap-around is harmless as long as fewer than 2^31 messages wait.
+
+// As with static queue, it can be used by hardware interrupts, so hardware level critical
+// sections are used for context access.
+namespace kernel::internal::priority_queue
+{
+    // Type strong index of Priority Queue.
+    enum class Id : uint32_t{};
+
+    // Priority of messages sent with sendToFront. It is above any user Priority value.
+    constexpr uint16_t front_priority{ 0x100U};
+
+    struct PriorityQueue
+    {
+        size_t                              m_current_size{ 0U};
+        uint32_t                            m_sequence{ 0U};
+
+        size_t                              m_data_max_elements{ 0U};
+        size_t                              m_data_type_size{ 0U};
+        uint8_t *                           mp_data{ nullptr};
+        kernel::priority_queue::Entry *     mp_entries{ nullptr};
+    };
+
+    // Type strong memory index for allocated Priority Queue type.
+    typedef common::MemoryBuffer< PriorityQueue, max_number>::Id MemoryBufferIndex;
+
+    struct Context
+    {
+        common::MemoryBuffer< PriorityQueue, max_number> m_data{};
+    };
+
+    inline bool create(
+        Context &                           a_context,
+        Id &                                a_id,
+        size_t                              a_data_max_elements,
+        size_t                              a_data_type_size,
+        void * const                        ap_static_buffer,
+        kernel::priority_queue::Entry *     ap_entries
+    )
+    {
+        assert( nullptr != ap_static_buffer);
+        assert( nullptr != ap_entries);
+
+        kernel::hardware::CriticalSection critical_section{ critical_section_priority};
+
+        MemoryBufferIndex new_queue_id;
+
+        if ( false == a_context.m_data.allocate( new_queue_id))
+        {
+            return false;
+        }
+
+        a_id = static_cast< Id>( new_queue_id);
+
+        PriorityQueue & new_queue = a_context.m_data.at( new_queue_id);
+
+        new_queue.m_current_size = 0U;
+        new_queue.m_sequence = 0U;
+
+        new_queue.m_data_max_elements = a_data_max_elements;
+        new_queue.m_data_type_size = a_data_type_size;
+        new_queue.mp_data = reinterpret_cast< uint8_t *>( ap_static_buffer);
+        new_queue.mp_entries = ap_entries;
+
+        // All slots are free.
+        for ( size_t i = 0U; i < a_data_max_elements; ++i)
+        {
+            ap_entries[ i].m_slot = static_cast< uint16_t>( i);
+        }
+
+        return true;
+    }
+
+    inline void destroy( Context & a_context, Id & a_id)
+    {
+        kernel::hardware::CriticalSection critical_section{ critical_section_priority};
+
+        a_context.m_data.free( static_cast< MemoryBufferIndex>( a_id));
+    }
+
+    inline size_t getSize( Context & a_context, Id & a_id)
+    {
+        kernel::hardware::CriticalSection critical_section{ critical_section_priority};
+
+        return a_context.m_data.at( static_cast< MemoryBufferIndex>( a_id)).m_current_size;
+    }
+
+    inline bool isEmpty( Context & a_context, Id & a_id)
+    {
+        return ( 0U == getSize( a_context, a_id));
+    }
+
+    // Return 'true' if message a_first must be received before a_second.
+    // Front messages are received in reverse order of sending.
+    inline bool isBefore( const kernel::priority_queue::Entry & a_first, const kernel::priority_queue::Entry & a_second)
+    {
+        if ( a_first.m_priority != a_second.m_priority)
+        {
+            return ( a_first.m_priority > a_second.m_priority);
+        }
+
+        const int32_t sequence_difference = static_cast< int32_t>( a_first.m_sequence - a_second.m_sequence);
+
+        if ( front_priority == a_first.m_priority)
+        {
+            return ( sequence_difference > 0);
+        }
+
+        return ( sequence_difference < 0);
+    }
+
+    // Note: Must be called with critical section taken.
+    inline void siftUp( PriorityQueue & a_queue, size_t a_index)
+    {
+        kernel::priority_queue::Entry * p_entries = a_queue.mp_entries;
+        const kernel::priority_queue::Entry entry = p_entries[ a_index];
+
+        while ( a_index > 0U)
+        {
+            const size_t parent = ( a_index - 1U) / 2U;
+
+            if ( false == isBefore( entry, p_entries[ parent]))
+            {
+                break;
+            }
+
+            p_entries[ a_index] = p_entries[ parent];
+            a_index = parent;
+        }
+
+        p_entries[ a_index] = entry;
+    }
+
+    // Note: Must be called with critical section taken.
+    inline void siftDown( PriorityQueue & a_queue, size_t a_index)
+    {
+        kernel::priority_queue::Entry * p_entries = a_queue.mp_entries;
+        const kernel::priority_queue::Entry entry = p_entries[ a_index];
+
+        while ( true)
+        {
+            size_t child = ( 2U * a_index) + 1U;
+
+            if ( child >= a_queue.m_current_size)
+            {
+                break;
+            }
+
+            if ( ( ( child + 1U) < a_queue.m_current_size) && ( true == isBefore( p_entries[ child + 1U], p_entries[ child])))
+            {
+                ++child;
+            }
+
+            if ( false == isBefore( p_entries[ child], entry))
+            {
+                break;
+            }
+
+            p_entries[ a_index] = p_entries[ child];
+            a_index = child;
+        }
+
+        p_entries[ a_index] = entry;
+    }
+
+    // Copy message to free slot and add its Entry to the heap.
+    inline bool push( Context & a_context, Id & a_id, const void * const ap_data, uint16_t a_priority)
+    {
+        assert( nullptr != ap_data);
+
+        kernel::hardware::CriticalSection critical_section{ critical_section_priority};
+
+        PriorityQueue & queue = a_context.m_data.at( static_cast< MemoryBufferIndex>( a_id));
+
+        if ( queue.m_current_size >= queue.m_data_max_elements)
+        {
+            return false;
+        }
+
+        kernel::priority_queue::Entry & new_entry = queue.mp_entries[ queue.m_current_size];
+
+        // Memory copy.
+        {
+            uint8_t & destination = *( queue.mp_data + ( queue.m_data_type_size * new_entry.m_slot));
+            auto & source = *reinterpret_cast < const uint8_t *>( ap_data);
+
+            memory::copy( destination, source, queue.m_data_type_size);
+        }
+
+        new_entry.m_priority = a_priority;
+        new_entry.m_sequence = queue.m_sequence++;
+
+        siftUp( queue, queue.m_current_size);
+        ++queue.m_current_size;
+
+        return true;
+    }
+
+    inline bool send( Context & a_context, Id & a_id, const void * const ap_data, kernel::priority_queue::Priority a_priority)
+    {
+        return push( a_context, a_id, ap_data, a_priority);
+    }
+
+    inline bool sendToFront( Context & a_context, Id & a_id, const void * const ap_data)
+    {
+        return push( a_context, a_id, ap_data, front_priority);
+    }
+
+    // Pop message from the top of the heap. ap_priority is optional.
+    inline bool receive(
+        Context &                                   a_context,
+        Id &                                        a_id,
+        void * const                                ap_data,
+        kernel::priority_queue::Priority * const    ap_priority
+    )
+    {
+        assert( nullptr != ap_data);
+
+        kernel::hardware::CriticalSection critical_section{ critical_section_priority};
+
+        PriorityQueue & queue = a_context.m_data.at( static_cast< MemoryBufferIndex>( a_id));
+
+        if ( 0U == queue.m_current_size)
+        {
+            return false;
+        }
+
+        const kernel::priority_queue::Entry top = queue.mp_entries[ 0U];
+
+        // Memory copy.
+        {
+            auto & destination = *reinterpret_cast < uint8_t *>( ap_data);
+            const uint8_t & source = *( queue.mp_data + ( queue.m_data_type_size * top.m_slot));
+
+            memory::copy( destination, source, queue.m_data_type_size);
+        }
+
+        if ( nullptr != ap_priority)
+        {
+            *ap_priority = ( front_priority == top.m_priority) ?
+                0xFFU :
+                static_cast< kernel::priority_queue::Priority>( top.m_priority);
+        }
+
+        // Move the last Entry to the top and return slot of received message to free slots.
+        --queue.m_current_size;
+
+        queue.mp_entries[ 0U] = queue.mp_entries[ queue.m_current_size];
+        queue.mp_entries[ queue.m_current_size].m_slot = top.m_slot;
+
+        if ( queue.m_current_size > 0U)
+        {
+            siftDown( queue, 0U);
+        }
+
+        return true;
+    }
+}
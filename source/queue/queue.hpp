@@ -11,12 +11,48 @@
 // Queue main usage is data transfer between tasks and between tasks and hardware interrupts.
 // This require usage of hardware level critical sections for context access.
 
+// Typed queue (kernel::static_queue::Typed) keeps its buffer and indexes in user memory and
+// is sent to and received from by inlined template functions. Kernel only keeps pointer to
+// its indexes, so it can be waited for. Byte-wise send and receive do not support it.
+
+// Direct handoff: receiver blocked in receive with timeout registers its destination buffer.
+// Sender, which finds empty queue with registered receiver, copies item straight into that
+// buffer, skipping the queue buffer and the second copy. Only one receiver can be registered
+// at a time, other receivers wait for the queue to be not empty as usual. Registered receiver
+// waits for its own condition (handle::ObjectType::QueueReceiver), so handoff does not wake
+// other waiters of the empty queue. Registration is cleared when its task is terminated.
+
+// Trigger level: waiter is signaled when trigger level items are stored or queue is full, so
+// consumer can work in batches. Optional batch timeout bounds latency of items below trigger
+// level. It is measured from the tick when unconsumed item was first tested by a waiter, so
+// send path does not read system time, and restarts when queue is emptied.
+// Direct handoff is used only with trigger level 1.
+
+// Statistics: when enabled in config, counters are updated in the same critical sections as
+// queue indexes. Time spent full is sampled on system tick, so send path does not read system
+// time either. Typed queue is not counted, since its send and receive do not enter kernel.
+
 namespace kernel::internal::queue
 {
     // Type strong index of Queue.
     enum class Id : uint32_t{};
 
-    struct Queue
+    // Statistics of single queue. Queue derives from it, so disabled statistics are empty
+    // base and take no memory.
+    template < bool Enable>
+    struct StatsData
+    {
+        kernel::static_queue::Stats m_stats{};
+        TimeMs                      m_stats_sample_time{ 0U};
+        bool                        m_is_stats_sampled{ false};
+    };
+
+    template <>
+    struct StatsData< false>
+    {
+    };
+
+    struct Queue : StatsData< stats_enable>
     {
         size_t              m_current_size{ 0U};
         uint32_t            m_head{ 0U};
@@ -24,17 +60,36 @@ namespace kernel::internal::queue
         
         size_t              m_data_max_elements{ 0U};
         size_t              m_data_type_size{ 0U};
-        volatile uint8_t *  mp_data{ nullptr};
+        uint8_t *           mp_data{ nullptr};
 
         const char *        mp_name{ nullptr};
+
+        // Not null only for Typed queue.
+        kernel::static_queue::TypedIndexes * mp_typed_indexes{ nullptr};
+
+        // Direct handoff receiver. Destination is not null only while receiver is registered.
+        void *              mp_receiver_data{ nullptr};
+        kernel::Handle      m_receiver{};
+        bool                m_handoff_done{ false};
+
+        size_t              m_trigger_level{ 1U};
+        TimeMs              m_batch_timeout{ 0U};
+        TimeMs              m_batch_start{ 0U};
+        bool                m_has_batch_timeout{ false};
+        bool                m_is_batch_started{ false};
     };
 
+    static_assert(
+        critical_section_priority == kernel::static_queue::typed_critical_section_priority,
+        "Typed queue must use the same critical section priority as static queue!"
+    );
+
     // Type strong memory index for allocated Queue type.
     typedef common::MemoryBuffer< Queue, max_number>::Id MemoryBufferIndex;
 
     struct Context
     {
-        volatile common::MemoryBuffer< Queue, max_number> m_data{};
+        common::MemoryBuffer< Queue, max_number> m_data{};
     };
 
     inline bool create(
@@ -42,7 +97,7 @@ namespace kernel::internal::queue
         Id &                    a_id,
         size_t &                a_data_max_elements,
         size_t &                a_data_type_size,
-        volatile void * const   ap_static_buffer,
+        void * const            ap_static_buffer,
         const char *            ap_name
     )
     {
@@ -60,7 +115,7 @@ namespace kernel::internal::queue
 
         a_id = static_cast< Id>( new_queue_id);
 
-        volatile Queue & new_queue = a_context.m_data.at( new_queue_id);
+        Queue & new_queue = a_context.m_data.at( new_queue_id);
 
         // Initialize new Queue object.
         new_queue.m_current_size = 0U;
@@ -69,14 +124,80 @@ namespace kernel::internal::queue
         
         new_queue.m_data_max_elements = a_data_max_elements;
         new_queue.m_data_type_size = a_data_type_size;
-        new_queue.mp_data = reinterpret_cast< volatile uint8_t *>( ap_static_buffer);
+        new_queue.mp_data = reinterpret_cast< uint8_t *>( ap_static_buffer);
 
         // TODO: consider checking for dublicates.
+        new_queue.mp_name = ap_name;
+        new_queue.mp_typed_indexes = nullptr;
+
+        new_queue.mp_receiver_data = nullptr;
+        new_queue.m_handoff_done = false;
+
+        new_queue.m_trigger_level = 1U;
+        new_queue.m_has_batch_timeout = false;
+        new_queue.m_is_batch_started = false;
+
+        static_cast< StatsData< stats_enable> &>( new_queue) = StatsData< stats_enable>{};
+
+        return true;
+    }
+
+    inline bool createTyped(
+        Context &                               a_context,
+        Id &                                    a_id,
+        size_t                                  a_data_max_elements,
+        kernel::static_queue::TypedIndexes &    a_typed_indexes,
+        const char *                            ap_name
+    )
+    {
+        kernel::hardware::CriticalSection critical_section{ critical_section_priority};
+
+        MemoryBufferIndex new_queue_id;
+
+        if ( false == a_context.m_data.allocate( new_queue_id))
+        {
+            return false;
+        }
+
+        a_id = static_cast< Id>( new_queue_id);
+
+        Queue & new_queue = a_context.m_data.at( new_queue_id);
+
+        new_queue.m_current_size = 0U;
+        new_queue.m_head = 0U;
+        new_queue.m_tail = 0U;
+
+        new_queue.m_data_max_elements = a_data_max_elements;
+        new_queue.m_data_type_size = 0U;
+        new_queue.mp_data = nullptr;
+
         new_queue.mp_name = ap_name;
 
+        new_queue.mp_receiver_data = nullptr;
+        new_queue.m_handoff_done = false;
+
+        new_queue.m_trigger_level = 1U;
+        new_queue.m_has_batch_timeout = false;
+        new_queue.m_is_batch_started = false;
+
+        static_cast< StatsData< stats_enable> &>( new_queue) = StatsData< stats_enable>{};
+
+        a_typed_indexes.m_head = 0U;
+        a_typed_indexes.m_tail = 0U;
+        new_queue.mp_typed_indexes = &a_typed_indexes;
+
         return true;
     }
 
+    // Return name given on create, or nullptr for unnamed queue.
+    inline const char * getName( Context & a_context, Id & a_id)
+    {
+        kernel::hardware::CriticalSection critical_section{ critical_section_priority};
+
+        return a_context.m_data.at( static_cast< MemoryBufferIndex>( a_id)).mp_name;
+    }
+
+    // Find queue by name pointer. Used only when name registry is disabled.
     inline bool open( Context & a_context, Id & a_id, const char * ap_name)
     {
         assert( nullptr != ap_name);
@@ -105,13 +226,31 @@ namespace kernel::internal::queue
         a_context.m_data.free( static_cast< MemoryBufferIndex>( a_id));
     }
 
+    // Note: Must be called with critical section taken.
+    inline size_t getCurrentSize( const Queue & a_queue)
+    {
+        if ( nullptr != a_queue.mp_typed_indexes)
+        {
+            return a_queue.mp_typed_indexes->m_head - a_queue.mp_typed_indexes->m_tail;
+        }
+
+        return a_queue.m_current_size;
+    }
+
+    inline size_t getSize( Context & a_context, Id & a_id)
+    {
+        kernel::hardware::CriticalSection critical_section{ critical_section_priority};
+
+        return getCurrentSize( a_context.m_data.at( static_cast< MemoryBufferIndex>( a_id)));
+    }
+
     inline bool isFull( Context & a_context, Id & a_id)
     {
         kernel::hardware::CriticalSection critical_section{ critical_section_priority};
 
-        volatile Queue & queue = a_context.m_data.at( static_cast< MemoryBufferIndex>( a_id));
+        Queue & queue = a_context.m_data.at( static_cast< MemoryBufferIndex>( a_id));
 
-        bool is_queue_full = ( queue.m_current_size >= queue.m_data_max_elements);
+        bool is_queue_full = ( getCurrentSize( queue) >= queue.m_data_max_elements);
 
         return is_queue_full;
     }
@@ -120,95 +259,746 @@ namespace kernel::internal::queue
     {
         kernel::hardware::CriticalSection critical_section{ critical_section_priority};
 
-        bool is_queue_empty = ( 0U == a_context.m_data.at( static_cast< MemoryBufferIndex>( a_id)).m_current_size);
+        bool is_queue_empty = ( 0U == getCurrentSize( a_context.m_data.at( static_cast< MemoryBufferIndex>( a_id))));
 
         return is_queue_empty;
     }
 
-    // Push item to the head.
-    inline bool send( Context & a_context, Id & a_id, volatile void * const ap_data)
+    // a_trigger_level must be bigger than 0. Trigger level above queue size is reached only
+    // by full queue.
+    inline void setTriggerLevel(
+        Context &   a_context,
+        Id &        a_id,
+        size_t      a_trigger_level,
+        bool        a_has_batch_timeout,
+        TimeMs      a_batch_timeout
+    )
     {
-        assert( nullptr != ap_data);
+        assert( a_trigger_level > 0U);
+
+        kernel::hardware::CriticalSection critical_section{ critical_section_priority};
+
+        Queue & queue = a_context.m_data.at( static_cast< MemoryBufferIndex>( a_id));
+
+        queue.m_trigger_level = a_trigger_level;
+        queue.m_has_batch_timeout = a_has_batch_timeout;
+        queue.m_batch_timeout = a_batch_timeout;
+        queue.m_is_batch_started = false;
+    }
+
+    // Return 'true' if waiter should be woken up: trigger level is reached, queue is full or
+    // batch timeout elapsed.
+    // Note: Handed off item belongs to registered receiver only, see isHandoffDone.
+    inline bool isTriggered( Context & a_context, Id & a_id, TimeMs a_current)
+    {
+        kernel::hardware::CriticalSection critical_section{ critical_section_priority};
+
+        Queue & queue = a_context.m_data.at( static_cast< MemoryBufferIndex>( a_id));
+
+        const size_t current_size = getCurrentSize( queue);
+
+        if ( 0U == current_size)
+        {
+            queue.m_is_batch_started = false;
+            return false;
+        }
+
+        if ( ( current_size >= queue.m_trigger_level) || ( current_size >= queue.m_data_max_elements))
+        {
+            return true;
+        }
+
+        if ( false == queue.m_has_batch_timeout)
+        {
+            return false;
+        }
+
+        if ( false == queue.m_is_batch_started)
+        {
+            queue.m_is_batch_started = true;
+            queue.m_batch_start = a_current;
+        }
+
+        return ( ( a_current - queue.m_batch_start) >= queue.m_batch_timeout);
+    }
+
+    inline bool isTyped( Context & a_context, Id & a_id)
+    {
+        kernel::hardware::CriticalSection critical_section{ critical_section_priority};
+
+        return ( nullptr != a_context.m_data.at( static_cast< MemoryBufferIndex>( a_id)).mp_typed_indexes);
+    }
+
+    // Restart batch timeout measurement, when the last item was received.
+    // Note: Must be called with critical section taken.
+    inline void endBatchIfEmpty( Queue & a_queue)
+    {
+        if ( 0U == a_queue.m_current_size)
+        {
+            a_queue.m_is_batch_started = false;
+        }
+    }
+
+    // Note: Stats functions must be called with critical section taken. They are templates,
+    //       so code using members of disabled (empty) statistics is not compiled.
+    template < bool Enable>
+    inline void countSent( StatsData< Enable> & a_data, size_t a_current_size, size_t a_number_of_elements)
+    {
+        if constexpr ( Enable)
+        {
+            a_data.m_stats.m_total_sends += static_cast< uint32_t>( a_number_of_elements);
+
+            if ( a_current_size > a_data.m_stats.m_peak_size)
+            {
+                a_data.m_stats.m_peak_size = a_current_size;
+            }
+        }
+    }
+
+    template < bool Enable>
+    inline void countDropped( StatsData< Enable> & a_data, size_t a_number_of_elements)
+    {
+        if constexpr ( Enable)
+        {
+            a_data.m_stats.m_dropped_sends += static_cast< uint32_t>( a_number_of_elements);
+        }
+    }
+
+    template < bool Enable>
+    inline void countReceived( StatsData< Enable> & a_data, size_t a_number_of_elements)
+    {
+        if constexpr ( Enable)
+        {
+            a_data.m_stats.m_total_receives += static_cast< uint32_t>( a_number_of_elements);
+        }
+    }
+
+    // Add time between samples to time full, if queue is full.
+    template < bool Enable>
+    inline void sampleStats( StatsData< Enable> & a_data, bool a_is_full, TimeMs a_current)
+    {
+        if constexpr ( Enable)
+        {
+            if ( ( true == a_is_full) && ( true == a_data.m_is_stats_sampled))
+            {
+                a_data.m_stats.m_time_full += a_current - a_data.m_stats_sample_time;
+            }
+
+            a_data.m_stats_sample_time = a_current;
+            a_data.m_is_stats_sampled = true;
+        }
+    }
+
+    template < bool Enable>
+    inline void readStats( const StatsData< Enable> & a_data, kernel::static_queue::Stats & a_stats)
+    {
+        if constexpr ( Enable)
+        {
+            a_stats = a_data.m_stats;
+        }
+    }
 
+    // Peak size starts from current size.
+    template < bool Enable>
+    inline void clearStats( StatsData< Enable> & a_data, size_t a_current_size)
+    {
+        if constexpr ( Enable)
+        {
+            a_data.m_stats = kernel::static_queue::Stats{};
+            a_data.m_stats.m_peak_size = a_current_size;
+        }
+    }
+
+    // Record send, which gave up waiting for free space.
+    inline void countDroppedSend( Context & a_context, Id & a_id)
+    {
         kernel::hardware::CriticalSection critical_section{ critical_section_priority};
 
-        volatile Queue & queue = a_context.m_data.at( static_cast< MemoryBufferIndex>( a_id));
+        countDropped( a_context.m_data.at( static_cast< MemoryBufferIndex>( a_id)), 1U);
+    }
 
-        if ( true == isFull( a_context, a_id))
+    // Called on each system tick. Time between samples is added to time full of queues, which
+    // are full, so ticks skipped while kernel was locked are not lost.
+    inline void tickStats( Context & a_context, TimeMs a_current)
+    {
+        if constexpr ( stats_enable)
+        {
+            kernel::hardware::CriticalSection critical_section{ critical_section_priority};
+
+            for ( uint32_t i = 0U; i < max_number; ++i)
+            {
+                if ( true == a_context.m_data.isAllocated( static_cast< MemoryBufferIndex>( i)))
+                {
+                    Queue & queue = a_context.m_data.at( static_cast< MemoryBufferIndex>( i));
+
+                    const bool is_full = ( nullptr == queue.mp_typed_indexes) &&
+                        ( queue.m_current_size >= queue.m_data_max_elements);
+
+                    sampleStats( queue, is_full, a_current);
+                }
+            }
+        }
+    }
+
+    inline void getStats( Context & a_context, Id & a_id, kernel::static_queue::Stats & a_stats)
+    {
+        kernel::hardware::CriticalSection critical_section{ critical_section_priority};
+
+        readStats( a_context.m_data.at( static_cast< MemoryBufferIndex>( a_id)), a_stats);
+    }
+
+    inline void resetStats( Context & a_context, Id & a_id)
+    {
+        kernel::hardware::CriticalSection critical_section{ critical_section_priority};
+
+        Queue & queue = a_context.m_data.at( static_cast< MemoryBufferIndex>( a_id));
+
+        clearStats( queue, getCurrentSize( queue));
+    }
+
+    // Return index following a_index, wrapped to the beginning of the buffer.
+    inline uint32_t getNextIndex( const Queue & a_queue, uint32_t a_index)
+    {
+        ++a_index;
+
+        if ( a_index >= a_queue.m_data_max_elements)
+        {
+            a_index = 0U;
+        }
+
+        return a_index;
+    }
+
+    // Copy item directly to registered receiver. Return 'false' if there is no receiver.
+    // Note: Must be called with critical section taken.
+    inline bool handOff( Queue & a_queue, const void * const ap_data, kernel::Handle * const ap_woken_receiver)
+    {
+        // Items already in queue must be received first, to keep the order.
+        if ( ( nullptr == a_queue.mp_receiver_data) || ( 0U != a_queue.m_current_size))
         {
             return false;
         }
 
-        if ( false == isEmpty( a_context, a_id))
+        auto & destination = *reinterpret_cast < uint8_t *>( a_queue.mp_receiver_data);
+        auto & source = *reinterpret_cast < const uint8_t *>( ap_data);
+
+        memory::copy( destination, source, a_queue.m_data_type_size);
+
+        a_queue.mp_receiver_data = nullptr;
+        a_queue.m_handoff_done = true;
+
+        countSent( a_queue, a_queue.m_current_size, 1U);
+        countReceived( a_queue, 1U);
+
+        if ( nullptr != ap_woken_receiver)
         {
-            ++queue.m_head;
+            *ap_woken_receiver = a_queue.m_receiver;
+        }
+
+        return true;
+    }
+
+    // Push item to the head, or hand it off directly to registered receiver if queue is empty.
+    // On handoff, receiver is stored in ap_woken_receiver, so caller can wake it up at once.
+    // Note: m_head is index of the next free slot and m_tail is index of the oldest item.
+    // Full queue is counted as dropped send, unless a_count_dropped is 'false' (blocking send).
+    inline bool send(
+        Context &               a_context,
+        Id &                    a_id,
+        const void * const      ap_data,
+        kernel::Handle * const  ap_woken_receiver = nullptr,
+        bool                    a_count_dropped = true
+    )
+    {
+        assert( nullptr != ap_data);
 
-            if ( queue.m_head >= queue.m_data_max_elements)
+        kernel::hardware::CriticalSection critical_section{ critical_section_priority};
+
+        Queue & queue = a_context.m_data.at( static_cast< MemoryBufferIndex>( a_id));
+
+        if ( nullptr != queue.mp_typed_indexes)
+        {
+            return false;
+        }
+
+        if ( queue.m_current_size >= queue.m_data_max_elements)
+        {
+            if ( true == a_count_dropped)
             {
-                queue.m_head = 0U;
+                countDropped( queue, 1U);
             }
+
+            return false;
+        }
+
+        if ( true == handOff( queue, ap_data, ap_woken_receiver))
+        {
+            return true;
         }
 
         // Memory copy.
-        // todo: consider memory fence here.
+        // Note: No fence is needed, since hardware critical section is also a compiler barrier.
         {
             const size_t real_head_offset = queue.m_data_type_size * queue.m_head;
 
-            volatile uint8_t & destination = *( queue.mp_data + real_head_offset);
-            auto & source = *reinterpret_cast < const volatile uint8_t *>( ap_data);
+            uint8_t & destination = *( queue.mp_data + real_head_offset);
+            auto & source = *reinterpret_cast < const uint8_t *>( ap_data);
 
             memory::copy( destination, source, queue.m_data_type_size);
         }
 
+        queue.m_head = getNextIndex( queue, queue.m_head);
         ++queue.m_current_size;
+        countSent( queue, queue.m_current_size, 1U);
 
         return true;
     }
     
+    // Push item in front of the tail, so it is received before all items already in queue.
+    inline bool sendToFront(
+        Context &               a_context,
+        Id &                    a_id,
+        const void * const      ap_data,
+        kernel::Handle * const  ap_woken_receiver = nullptr
+    )
+    {
+        assert( nullptr != ap_data);
+
+        kernel::hardware::CriticalSection critical_section{ critical_section_priority};
+
+        Queue & queue = a_context.m_data.at( static_cast< MemoryBufferIndex>( a_id));
+
+        if ( nullptr != queue.mp_typed_indexes)
+        {
+            return false;
+        }
+
+        if ( queue.m_current_size >= queue.m_data_max_elements)
+        {
+            countDropped( queue, 1U);
+            return false;
+        }
+
+        if ( true == handOff( queue, ap_data, ap_woken_receiver))
+        {
+            return true;
+        }
+
+        const uint32_t new_tail = ( 0U == queue.m_tail) ?
+            static_cast< uint32_t>( queue.m_data_max_elements - 1U) :
+            ( queue.m_tail - 1U);
+
+        // Memory copy.
+        {
+            const size_t real_tail_offset = queue.m_data_type_size * new_tail;
+
+            uint8_t & destination = *( queue.mp_data + real_tail_offset);
+            auto & source = *reinterpret_cast < const uint8_t *>( ap_data);
+
+            memory::copy( destination, source, queue.m_data_type_size);
+        }
+
+        queue.m_tail = new_tail;
+        ++queue.m_current_size;
+        countSent( queue, queue.m_current_size, 1U);
+
+        return true;
+    }
+
     // Pop item from the tail.
-    inline bool receive( Context & a_context, Id & a_id, volatile void * const ap_data)
+    inline bool receive( Context & a_context, Id & a_id, void * const ap_data)
     {
         assert( nullptr != ap_data);
 
         kernel::hardware::CriticalSection critical_section{ critical_section_priority};
 
-        volatile Queue & queue = a_context.m_data.at( static_cast< MemoryBufferIndex>( a_id));
+        Queue & queue = a_context.m_data.at( static_cast< MemoryBufferIndex>( a_id));
+
+        if ( nullptr != queue.mp_typed_indexes)
+        {
+            return false;
+        }
 
-        if ( true == isEmpty( a_context, a_id))
+        if ( 0U == queue.m_current_size)
         {
             return false;
         }
 
         // Memory copy.
-        // todo: consider memory fence here.
+        // Note: No fence is needed, since hardware critical section is also a compiler barrier.
         {
             size_t real_tail_offset = queue.m_data_type_size * queue.m_tail;
 
-            auto & destination = *reinterpret_cast < volatile uint8_t *>( ap_data);
-            const volatile uint8_t & source = *( queue.mp_data + real_tail_offset);
+            auto & destination = *reinterpret_cast < uint8_t *>( ap_data);
+            const uint8_t & source = *( queue.mp_data + real_tail_offset);
 
             memory::copy( destination, source, queue.m_data_type_size);
         }
 
-        if ( queue.m_current_size > 1U)
+        queue.m_tail = getNextIndex( queue, queue.m_tail);
+        --queue.m_current_size;
+        endBatchIfEmpty( queue);
+        countReceived( queue, 1U);
+
+        return true;
+    }
+
+    // Pop item from the tail, or register a_receiver for direct handoff into ap_data if queue
+    // is empty. Return 'true' only if item was received.
+    // Note: Registration is skipped if other receiver is already registered.
+    inline bool receiveOrRegister(
+        Context &               a_context,
+        Id &                    a_id,
+        void * const            ap_data,
+        const kernel::Handle &  a_receiver
+    )
+    {
+        assert( nullptr != ap_data);
+
+        kernel::hardware::CriticalSection critical_section{ critical_section_priority};
+
+        Queue & queue = a_context.m_data.at( static_cast< MemoryBufferIndex>( a_id));
+
+        if ( nullptr != queue.mp_typed_indexes)
+        {
+            return false;
+        }
+
+        if ( 0U != queue.m_current_size)
         {
-            ++queue.m_tail;
+            size_t real_tail_offset = queue.m_data_type_size * queue.m_tail;
+
+            auto & destination = *reinterpret_cast < uint8_t *>( ap_data);
+            const uint8_t & source = *( queue.mp_data + real_tail_offset);
 
-            if ( queue.m_tail >= queue.m_data_max_elements)
+            memory::copy( destination, source, queue.m_data_type_size);
+
+            queue.m_tail = getNextIndex( queue, queue.m_tail);
+            --queue.m_current_size;
+            endBatchIfEmpty( queue);
+            countReceived( queue, 1U);
+
+            return true;
+        }
+
+        if ( ( nullptr == queue.mp_receiver_data) && ( false == queue.m_handoff_done) && ( 1U == queue.m_trigger_level))
+        {
+            queue.mp_receiver_data = ap_data;
+            queue.m_receiver = a_receiver;
+        }
+
+        return false;
+    }
+
+    // Unregister a_receiver. Return 'true' if item was handed off to it in the meantime.
+    inline bool unregisterReceiver( Context & a_context, Id & a_id, const kernel::Handle & a_receiver)
+    {
+        kernel::hardware::CriticalSection critical_section{ critical_section_priority};
+
+        Queue & queue = a_context.m_data.at( static_cast< MemoryBufferIndex>( a_id));
+
+        if ( a_receiver != queue.m_receiver)
+        {
+            return false;
+        }
+
+        if ( true == queue.m_handoff_done)
+        {
+            queue.m_handoff_done = false;
+            return true;
+        }
+
+        queue.mp_receiver_data = nullptr;
+
+        return false;
+    }
+
+    // Return 'true' if item was handed off and registered receiver did not pick it up yet.
+    inline bool isHandoffDone( Context & a_context, Id & a_id)
+    {
+        kernel::hardware::CriticalSection critical_section{ critical_section_priority};
+
+        return a_context.m_data.at( static_cast< MemoryBufferIndex>( a_id)).m_handoff_done;
+    }
+
+    // Return 'true' if a_receiver is registered for direct handoff, or item was handed off to it.
+    inline bool isRegisteredReceiver( Context & a_context, Id & a_id, const kernel::Handle & a_receiver)
+    {
+        kernel::hardware::CriticalSection critical_section{ critical_section_priority};
+
+        const Queue & queue = a_context.m_data.at( static_cast< MemoryBufferIndex>( a_id));
+
+        const bool is_registered = ( nullptr != queue.mp_receiver_data) || ( true == queue.m_handoff_done);
+
+        return ( true == is_registered) && ( a_receiver == queue.m_receiver);
+    }
+
+    // Clear a_task registration in all queues, so no item is handed off to stack of terminated task.
+    inline void unregisterTask( Context & a_context, const kernel::Handle & a_task)
+    {
+        kernel::hardware::CriticalSection critical_section{ critical_section_priority};
+
+        for ( uint32_t i = 0U; i < max_number; ++i)
+        {
+            if ( false == a_context.m_data.isAllocated( static_cast< MemoryBufferIndex>( i)))
+            {
+                continue;
+            }
+
+            Queue & queue = a_context.m_data.at( static_cast< MemoryBufferIndex>( i));
+
+            if ( a_task == queue.m_receiver)
             {
-                queue.m_tail = 0U;
+                queue.mp_receiver_data = nullptr;
+                queue.m_handoff_done = false;
+                queue.m_receiver = kernel::Handle{};
             }
         }
+    }
 
-        --queue.m_current_size;
+    // Push up to a_number_of_elements items to the head in single critical section.
+    // Items are copied in at most two contiguous blocks: up to the end of the buffer
+    // and from its beginning. Return number of items sent.
+    inline size_t sendN(
+        Context &           a_context,
+        Id &                a_id,
+        const void * const  ap_data,
+        size_t              a_number_of_elements
+    )
+    {
+        assert( nullptr != ap_data);
+
+        kernel::hardware::CriticalSection critical_section{ critical_section_priority};
+
+        Queue & queue = a_context.m_data.at( static_cast< MemoryBufferIndex>( a_id));
+
+        if ( nullptr != queue.mp_typed_indexes)
+        {
+            return 0U;
+        }
+
+        const size_t free_elements = queue.m_data_max_elements - queue.m_current_size;
+        const size_t elements_to_send = ( a_number_of_elements < free_elements) ? a_number_of_elements : free_elements;
+
+        countDropped( queue, a_number_of_elements - elements_to_send);
+
+        if ( 0U == elements_to_send)
+        {
+            return 0U;
+        }
+
+        const size_t elements_to_end = queue.m_data_max_elements - queue.m_head;
+        const size_t first_block = ( elements_to_send < elements_to_end) ? elements_to_send : elements_to_end;
+        const size_t second_block = elements_to_send - first_block;
+
+        auto source = reinterpret_cast < const uint8_t *>( ap_data);
+
+        memory::copy(
+            *( queue.mp_data + queue.m_data_type_size * queue.m_head),
+            *source,
+            first_block * queue.m_data_type_size
+        );
+
+        if ( second_block > 0U)
+        {
+            memory::copy(
+                *queue.mp_data,
+                *( source + first_block * queue.m_data_type_size),
+                second_block * queue.m_data_type_size
+            );
+
+            queue.m_head = static_cast< uint32_t>( second_block);
+        }
+        else
+        {
+            queue.m_head = static_cast< uint32_t>( ( first_block < elements_to_end) ? queue.m_head + first_block : 0U);
+        }
+
+        queue.m_current_size += elements_to_send;
+        countSent( queue, queue.m_current_size, elements_to_send);
+
+        return elements_to_send;
+    }
+
+    // Pop up to a_number_of_elements items from the tail in single critical section.
+    // Items are copied in at most two contiguous blocks. Return number of items received.
+    inline size_t receiveN(
+        Context &           a_context,
+        Id &                a_id,
+        void * const        ap_data,
+        size_t              a_number_of_elements
+    )
+    {
+        assert( nullptr != ap_data);
+
+        kernel::hardware::CriticalSection critical_section{ critical_section_priority};
+
+        Queue & queue = a_context.m_data.at( static_cast< MemoryBufferIndex>( a_id));
+
+        if ( nullptr != queue.mp_typed_indexes)
+        {
+            return 0U;
+        }
+
+        const size_t elements_to_receive =
+            ( a_number_of_elements < queue.m_current_size) ? a_number_of_elements : queue.m_current_size;
+
+        if ( 0U == elements_to_receive)
+        {
+            return 0U;
+        }
+
+        const size_t elements_to_end = queue.m_data_max_elements - queue.m_tail;
+        const size_t first_block = ( elements_to_receive < elements_to_end) ? elements_to_receive : elements_to_end;
+        const size_t second_block = elements_to_receive - first_block;
+
+        auto destination = reinterpret_cast < uint8_t *>( ap_data);
+
+        memory::copy(
+            *destination,
+            *( queue.mp_data + queue.m_data_type_size * queue.m_tail),
+            first_block * queue.m_data_type_size
+        );
+
+        if ( second_block > 0U)
+        {
+            memory::copy(
+                *( destination + first_block * queue.m_data_type_size),
+                *queue.mp_data,
+                second_block * queue.m_data_type_size
+            );
+
+            queue.m_tail = static_cast< uint32_t>( second_block);
+        }
+        else
+        {
+            queue.m_tail = static_cast< uint32_t>( ( first_block < elements_to_end) ? queue.m_tail + first_block : 0U);
+        }
+
+        queue.m_current_size -= elements_to_receive;
+        endBatchIfEmpty( queue);
+        countReceived( queue, elements_to_receive);
+
+        return elements_to_receive;
+    }
+
+    // Zero-copy access.
+    // Reserve and peek return linear part of free (or used) elements, which ends at the buffer end.
+    // Caller access returned memory outside critical section, so only one producer can have
+    // memory reserved and only one consumer can have memory peeked at a time.
+
+    // Return pointer to first free element and number of free contiguous elements.
+    // Return nullptr when queue is full.
+    inline uint8_t * reserve( Context & a_context, Id & a_id, size_t & a_number_of_elements)
+    {
+        kernel::hardware::CriticalSection critical_section{ critical_section_priority};
+
+        Queue & queue = a_context.m_data.at( static_cast< MemoryBufferIndex>( a_id));
+
+        a_number_of_elements = 0U;
+
+        if ( nullptr != queue.mp_typed_indexes)
+        {
+            return nullptr;
+        }
+
+        const size_t free_elements = queue.m_data_max_elements - queue.m_current_size;
+        const size_t elements_to_end = queue.m_data_max_elements - queue.m_head;
+
+        a_number_of_elements = ( free_elements < elements_to_end) ? free_elements : elements_to_end;
+
+        if ( 0U == a_number_of_elements)
+        {
+            return nullptr;
+        }
+
+        return queue.mp_data + queue.m_data_type_size * queue.m_head;
+    }
+
+    // Make a_number_of_elements reserved elements available to the consumer.
+    inline bool commit( Context & a_context, Id & a_id, size_t a_number_of_elements)
+    {
+        kernel::hardware::CriticalSection critical_section{ critical_section_priority};
+
+        Queue & queue = a_context.m_data.at( static_cast< MemoryBufferIndex>( a_id));
+
+        if ( nullptr != queue.mp_typed_indexes)
+        {
+            return false;
+        }
+
+        const size_t free_elements = queue.m_data_max_elements - queue.m_current_size;
+        const size_t elements_to_end = queue.m_data_max_elements - queue.m_head;
+
+        if ( ( a_number_of_elements > free_elements) || ( a_number_of_elements > elements_to_end))
+        {
+            return false;
+        }
+
+        queue.m_head = static_cast< uint32_t>(
+            ( a_number_of_elements < elements_to_end) ? queue.m_head + a_number_of_elements : 0U
+        );
+
+        queue.m_current_size += a_number_of_elements;
+        countSent( queue, queue.m_current_size, a_number_of_elements);
 
         return true;
     }
 
-    inline size_t getSize( Context & a_context, Id & a_id)
+    // Return pointer to the oldest element and number of used contiguous elements.
+    // Return nullptr when queue is empty.
+    inline const uint8_t * peek( Context & a_context, Id & a_id, size_t & a_number_of_elements)
     {
         kernel::hardware::CriticalSection critical_section{ critical_section_priority};
 
-        return a_context.m_data.at( static_cast< MemoryBufferIndex>( a_id)).m_current_size;
+        Queue & queue = a_context.m_data.at( static_cast< MemoryBufferIndex>( a_id));
+
+        a_number_of_elements = 0U;
+
+        if ( nullptr != queue.mp_typed_indexes)
+        {
+            return nullptr;
+        }
+
+        const size_t elements_to_end = queue.m_data_max_elements - queue.m_tail;
+
+        a_number_of_elements = ( queue.m_current_size < elements_to_end) ? queue.m_current_size : elements_to_end;
+
+        if ( 0U == a_number_of_elements)
+        {
+            return nullptr;
+        }
+
+        return queue.mp_data + queue.m_data_type_size * queue.m_tail;
+    }
+
+    // Release a_number_of_elements peeked elements back to the producer.
+    inline bool consume( Context & a_context, Id & a_id, size_t a_number_of_elements)
+    {
+        kernel::hardware::CriticalSection critical_section{ critical_section_priority};
+
+        Queue & queue = a_context.m_data.at( static_cast< MemoryBufferIndex>( a_id));
+
+        if ( nullptr != queue.mp_typed_indexes)
+        {
+            return false;
+        }
+
+        const size_t elements_to_end = queue.m_data_max_elements - queue.m_tail;
+
+        if ( ( a_number_of_elements > queue.m_current_size) || ( a_number_of_elements > elements_to_end))
+        {
+            return false;
+        }
+
+        queue.m_tail = static_cast< uint32_t>(
+            ( a_number_of_elements < elements_to_end) ? queue.m_tail + a_number_of_elements : 0U
+        );
+
+        queue.m_current_size -= a_number_of_elements;
+        endBatchIfEmpty( queue);
+        countReceived( queue, a_number_of_elements);
+
+        return true;
     }
 }
@@ -0,0 +1,373 @@
+#pragma once
+
+#include "config/config.hpp"
+#include "common/memory_buffer.hpp"
+
+#include <array>
+
+#include "../kernel.hpp"
+
+// Queue Set implementation.
+
+// Set groups static queues and events (members), so single task can wait for all of them
+// without testing each member on every system tick. Member which becomes ready is appended
+// to ready FIFO of its set. FIFO is intrusive list threaded through membership table, so
+// each member is queued at most once and no additional buffer is required.
+
+// Membership table is indexed by member slot: static queues take the first slots, events
+// the following ones. Mapping handle to slot is done by the caller.
+
+// Member is queued again on selection of the next member, if it is still ready (ie. selected
+// queue was not emptied), so no item is lost when receiver takes only one item at a time.
+
+// Member can be drained without select (ie. by direct receive from queue), while it is queued.
+// Such stale members are dropped from the head of FIFO when set is tested, so set is signaled
+// only when it holds ready member. Stale members behind ready one are skipped by select.
+
+// Members are notified by hardware interrupts too, so hardware level critical sections are
+// used for context access.
+namespace kernel::internal::queue_set
+{
+    // Type strong index of Queue Set.
+    enum class Id : uint32_t{};
+
+    constexpr uint32_t max_members{ ( max_number > 0U) ?
+        static_cast< uint32_t>( queue::max_number + event::max_number) :
+        0U
+    };
+
+    // Slot of end of FIFO.
+    constexpr uint32_t no_slot{ 0xFFFF'FFFFU};
+
+    struct Member
+    {
+        kernel::Handle  m_handle{};
+        Id              m_set{};
+        uint32_t        m_next{ no_slot};   // Next member in ready FIFO.
+        bool            m_is_member{ false};
+        bool            m_is_queued{ false};
+    };
+
+    struct QueueSet
+    {
+        uint32_t        m_head{ no_slot};
+        uint32_t        m_tail{ no_slot};
+
+        // Member returned by the last pop. It is queued again on the next pop, if still ready.
+        uint32_t        m_last_selected{ no_slot};
+
+        // Task blocked in select. It is woken up directly by member notification.
+        kernel::Handle  m_receiver{};
+        bool            m_receiver_registered{ false};
+    };
+
+    // Type strong memory index for allocated Queue Set type.
+    typedef common::MemoryBuffer< QueueSet, max_number>::Id MemoryBufferIndex;
+
+    struct Context
+    {
+        common::MemoryBuffer< QueueSet, max_number> m_data{};
+        // Note: std::array is used, since it can be empty, when queue sets are disabled.
+        std::array< Member, max_members> m_members{};
+    };
+
+    inline bool create( Context & a_context, Id & a_id)
+    {
+        kernel::hardware::CriticalSection critical_section{ critical_section_priority};
+
+        MemoryBufferIndex new_set_id;
+
+        if ( false == a_context.m_data.allocate( new_set_id))
+        {
+            return false;
+        }
+
+        a_id = static_cast< Id>( new_set_id);
+
+        a_context.m_data.at( new_set_id) = QueueSet{};
+
+        return true;
+    }
+
+    // Members of destroyed set are released.
+    inline void destroy( Context & a_context, Id & a_id)
+    {
+        kernel::hardware::CriticalSection critical_section{ critical_section_priority};
+
+        for ( Member & member : a_context.m_members)
+        {
+            if ( ( true == member.m_is_member) && ( a_id == member.m_set))
+            {
+                member = Member{};
+            }
+        }
+
+        a_context.m_data.free( static_cast< MemoryBufferIndex>( a_id));
+    }
+
+    // Note: Must be called with critical section taken.
+    inline void push( QueueSet & a_set, Context & a_context, uint32_t a_slot)
+    {
+        Member & member = a_context.m_members[ a_slot];
+
+        member.m_next = no_slot;
+        member.m_is_queued = true;
+
+        if ( no_slot == a_set.m_tail)
+        {
+            a_set.m_head = a_slot;
+        }
+        else
+        {
+            a_context.m_members[ a_set.m_tail].m_next = a_slot;
+        }
+
+        a_set.m_tail = a_slot;
+    }
+
+    // Return 'false' if member already belongs to any set.
+    inline bool addMember( Context & a_context, Id & a_id, uint32_t a_slot, const kernel::Handle & a_member)
+    {
+        assert( a_slot < max_members);
+
+        kernel::hardware::CriticalSection critical_section{ critical_section_priority};
+
+        Member & member = a_context.m_members[ a_slot];
+
+        if ( true == member.m_is_member)
+        {
+            return false;
+        }
+
+        member = Member{};
+        member.m_handle = a_member;
+        member.m_set = a_id;
+        member.m_is_member = true;
+
+        return true;
+    }
+
+    // Remove member from its set and from ready FIFO. Return 'false' if a_slot is not a member.
+    inline bool removeMember( Context & a_context, uint32_t a_slot)
+    {
+        assert( a_slot < max_members);
+
+        kernel::hardware::CriticalSection critical_section{ critical_section_priority};
+
+        Member & member = a_context.m_members[ a_slot];
+
+        if ( false == member.m_is_member)
+        {
+            return false;
+        }
+
+        QueueSet & set = a_context.m_data.at( static_cast< MemoryBufferIndex>( member.m_set));
+
+        if ( true == member.m_is_queued)
+        {
+            uint32_t previous = no_slot;
+            uint32_t current = set.m_head;
+
+            while ( a_slot != current)
+            {
+                previous = current;
+                current = a_context.m_members[ current].m_next;
+            }
+
+            if ( no_slot == previous)
+            {
+                set.m_head = member.m_next;
+            }
+            else
+            {
+                a_context.m_members[ previous].m_next = member.m_next;
+            }
+
+            if ( a_slot == set.m_tail)
+            {
+                set.m_tail = previous;
+            }
+        }
+
+        if ( a_slot == set.m_last_selected)
+        {
+            set.m_last_selected = no_slot;
+        }
+
+        member = Member{};
+
+        return true;
+    }
+
+    inline bool isMember( Context & a_context, uint32_t a_slot, Id & a_id)
+    {
+        assert( a_slot < max_members);
+
+        kernel::hardware::CriticalSection critical_section{ critical_section_priority};
+
+        const Member & member = a_context.m_members[ a_slot];
+
+        return ( true == member.m_is_member) && ( a_id == member.m_set);
+    }
+
+    // Append ready member to FIFO of its set, unless it is already queued or is not a member.
+    // If set receiver was waiting for empty set, it is unregistered and returned in
+    // ap_woken_receiver, so caller can wake it up.
+    inline void notify( Context & a_context, uint32_t a_slot, kernel::Handle * const ap_woken_receiver)
+    {
+        assert( a_slot < max_members);
+
+        kernel::hardware::CriticalSection critical_section{ critical_section_priority};
+
+        Member & member = a_context.m_members[ a_slot];
+
+        if ( ( false == member.m_is_member) || ( true == member.m_is_queued))
+        {
+            return;
+        }
+
+        QueueSet & set = a_context.m_data.at( static_cast< MemoryBufferIndex>( member.m_set));
+
+        push( set, a_context, a_slot);
+
+        if ( ( true == set.m_receiver_registered) && ( nullptr != ap_woken_receiver))
+        {
+            *ap_woken_receiver = set.m_receiver;
+            set.m_receiver_registered = false;
+        }
+    }
+
+    // Return member selected by the last pop and forget it. Caller should notify it again,
+    // if it is still ready.
+    inline bool takeLastSelected( Context & a_context, Id & a_id, kernel::Handle & a_member, uint32_t & a_slot)
+    {
+        kernel::hardware::CriticalSection critical_section{ critical_section_priority};
+
+        QueueSet & set = a_context.m_data.at( static_cast< MemoryBufferIndex>( a_id));
+
+        a_slot = set.m_last_selected;
+        set.m_last_selected = no_slot;
+
+        if ( no_slot == a_slot)
+        {
+            return false;
+        }
+
+        a_member = a_context.m_members[ a_slot].m_handle;
+
+        return true;
+    }
+
+    // Note: Must be called with critical section taken and non empty FIFO.
+    inline void popHead( QueueSet & a_set, Context & a_context, kernel::Handle & a_member, uint32_t & a_slot)
+    {
+        a_slot = a_set.m_head;
+
+        Member & member = a_context.m_members[ a_slot];
+
+        a_set.m_head = member.m_next;
+
+        if ( no_slot == a_set.m_head)
+        {
+            a_set.m_tail = no_slot;
+        }
+
+        member.m_next = no_slot;
+        member.m_is_queued = false;
+
+        a_set.m_last_selected = a_slot;
+        a_member = member.m_handle;
+    }
+
+    // Pop the oldest ready member. Return 'false' if FIFO is empty.
+    inline bool pop( Context & a_context, Id & a_id, kernel::Handle & a_member, uint32_t & a_slot)
+    {
+        kernel::hardware::CriticalSection critical_section{ critical_section_priority};
+
+        QueueSet & set = a_context.m_data.at( static_cast< MemoryBufferIndex>( a_id));
+
+        if ( no_slot == set.m_head)
+        {
+            return false;
+        }
+
+        popHead( set, a_context, a_member, a_slot);
+
+        return true;
+    }
+
+    // As pop, but if FIFO is empty, register a_receiver, so it can be woken up by the next
+    // notification.
+    inline bool popOrRegister(
+        Context &                   a_context,
+        Id &                        a_id,
+        kernel::Handle &            a_member,
+        uint32_t &                  a_slot,
+        const kernel::Handle &      a_receiver
+    )
+    {
+        kernel::hardware::CriticalSection critical_section{ critical_section_priority};
+
+        QueueSet & set = a_context.m_data.at( static_cast< MemoryBufferIndex>( a_id));
+
+        if ( no_slot == set.m_head)
+        {
+            set.m_receiver = a_receiver;
+            set.m_receiver_registered = true;
+
+            return false;
+        }
+
+        popHead( set, a_context, a_member, a_slot);
+
+        return true;
+    }
+
+    inline void unregisterReceiver( Context & a_context, Id & a_id)
+    {
+        kernel::hardware::CriticalSection critical_section{ critical_section_priority};
+
+        a_context.m_data.at( static_cast< MemoryBufferIndex>( a_id)).m_receiver_registered = false;
+    }
+
+    inline bool isEmpty( Context & a_context, Id & a_id)
+    {
+        kernel::hardware::CriticalSection critical_section{ critical_section_priority};
+
+        return ( no_slot == a_context.m_data.at( static_cast< MemoryBufferIndex>( a_id)).m_head);
+    }
+
+    // Drop members, which are not ready anymore, from the head of FIFO. Return 'true' if FIFO
+    // still holds ready member.
+    // Note: a_is_member_ready is called with critical section taken, so member cannot become
+    //       ready (and be notified) while it is dropped.
+    template < typename TIsMemberReady>
+    inline bool hasReadyMember( Context & a_context, Id & a_id, TIsMemberReady a_is_member_ready)
+    {
+        kernel::hardware::CriticalSection critical_section{ critical_section_priority};
+
+        QueueSet & set = a_context.m_data.at( static_cast< MemoryBufferIndex>( a_id));
+
+        while ( no_slot != set.m_head)
+        {
+            Member & member = a_context.m_members[ set.m_head];
+
+            if ( true == a_is_member_ready( member.m_handle))
+            {
+                return true;
+            }
+
+            set.m_head = member.m_next;
+
+            if ( no_slot == set.m_head)
+            {
+                set.m_tail = no_slot;
+            }
+
+            member.m_next = no_slot;
+            member.m_is_queued = false;
+        }
+
+        return false;
+    }
+}
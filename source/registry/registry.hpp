@@ -0,0 +1,240 @@
+#pragma once
+
+#include "config/config.hpp"
+
+#include "../kernel.hpp"
+
+#include <array>
+#include <cassert>
+
+// Kernel-wide registry of named system objects.
+
+// Registry is open addressing hash table with linear probing. Name hash is computed from the
+// literal, usually at compile time, so lookup compares hashes first and touches name strings
+// only to confirm a match. Pointers are compared before strings, since the same literal is
+// usually merged by linker. Removed entries are filled by shifting following entries back,
+// so no tombstones are needed.
+
+// Entry can also hold binding: pointer to user handle, which is written when object with the
+// same name is registered and reset to empty handle when it is removed. Entry without
+// registered object only keeps binding. Each name can have single binding.
+
+// Named objects can be opened from interrupt handlers, so hardware level critical sections
+// are used for context access.
+namespace kernel::internal::registry
+{
+    struct Entry
+    {
+        const char *        mp_name{ nullptr};      // Empty entry when nullptr.
+        uint32_t            m_hash{ 0U};
+        kernel::Handle      m_handle{};
+        bool                m_registered{ false};   // Only binding is kept when 'false'.
+        kernel::Handle *    mp_binding{ nullptr};
+    };
+
+    struct Context
+    {
+        std::array< Entry, max_number> m_entries{};    // Empty when registry is disabled.
+    };
+
+    constexpr uint32_t index_mask{ static_cast< uint32_t>( max_number - 1U)};
+
+    // Compare strings without <cstring>.
+    inline bool isSameString( const char * ap_left, const char * ap_right)
+    {
+        while ( ( '\0' != *ap_left) && ( *ap_left == *ap_right))
+        {
+            ++ap_left;
+            ++ap_right;
+        }
+
+        return ( *ap_left == *ap_right);
+    }
+
+    inline bool isSameName( const Entry & a_entry, const kernel::Name & a_name)
+    {
+        if ( a_entry.m_hash != a_name.m_hash)
+        {
+            return false;
+        }
+
+        return ( a_entry.mp_name == a_name.mp_string) || isSameString( a_entry.mp_name, a_name.mp_string);
+    }
+
+    // Return index of entry with a_name, or index of the first empty entry in its probe
+    // sequence. Return max_number if there is neither.
+    // Note: Must be called with critical section taken.
+    inline uint32_t findIndex( const Context & a_context, const kernel::Name & a_name)
+    {
+        uint32_t index = a_name.m_hash & index_mask;
+
+        for ( uint32_t i = 0U; i < max_number; ++i)
+        {
+            const Entry & entry = a_context.m_entries[ index];
+
+            if ( ( nullptr == entry.mp_name) || ( true == isSameName( entry, a_name)))
+            {
+                return index;
+            }
+
+            index = ( index + 1U) & index_mask;
+        }
+
+        return max_number;
+    }
+
+    // Remove entry and shift back entries, which probe sequence went through it.
+    // Note: Must be called with critical section taken.
+    inline void removeIndex( Context & a_context, uint32_t a_index)
+    {
+        uint32_t next = a_index;
+
+        while ( true)
+        {
+            next = ( next + 1U) & index_mask;
+
+            const Entry & next_entry = a_context.m_entries[ next];
+
+            if ( ( nullptr == next_entry.mp_name) || ( next == a_index))
+            {
+                break;
+            }
+
+            const uint32_t home = next_entry.m_hash & index_mask;
+
+            // Entry can be moved, if its home is not cyclically between removed entry and itself.
+            const uint32_t distance_to_home = ( next - home) & index_mask;
+            const uint32_t distance_to_removed = ( next - a_index) & index_mask;
+
+            if ( distance_to_home >= distance_to_removed)
+            {
+                a_context.m_entries[ a_index] = next_entry;
+                a_index = next;
+            }
+        }
+
+        a_context.m_entries[ a_index] = Entry{};
+    }
+
+    // Return 'false' if name is already registered or registry is full.
+    inline bool add( Context & a_context, const kernel::Name & a_name, const kernel::Handle & a_handle)
+    {
+        assert( nullptr != a_name.mp_string);
+
+        kernel::hardware::CriticalSection critical_section{ critical_section_priority};
+
+        const uint32_t index = findIndex( a_context, a_name);
+
+        if ( max_number == index)
+        {
+            return false;
+        }
+
+        Entry & entry = a_context.m_entries[ index];
+
+        if ( true == entry.m_registered)
+        {
+            return false;
+        }
+
+        if ( nullptr == entry.mp_name)
+        {
+            entry.mp_name = a_name.mp_string;
+            entry.m_hash = a_name.m_hash;
+        }
+
+        entry.m_handle = a_handle;
+        entry.m_registered = true;
+
+        if ( nullptr != entry.mp_binding)
+        {
+            *entry.mp_binding = a_handle;
+        }
+
+        return true;
+    }
+
+    inline bool find( Context & a_context, const kernel::Name & a_name, kernel::Handle & a_handle)
+    {
+        assert( nullptr != a_name.mp_string);
+
+        kernel::hardware::CriticalSection critical_section{ critical_section_priority};
+
+        const uint32_t index = findIndex( a_context, a_name);
+
+        if ( ( max_number == index) || ( false == a_context.m_entries[ index].m_registered))
+        {
+            return false;
+        }
+
+        a_handle = a_context.m_entries[ index].m_handle;
+
+        return true;
+    }
+
+    // Unregister object. Binding, if any, is reset to empty handle, so stale handle is not used,
+    // and kept for the next object with the same name.
+    inline void remove( Context & a_context, const kernel::Name & a_name)
+    {
+        assert( nullptr != a_name.mp_string);
+
+        kernel::hardware::CriticalSection critical_section{ critical_section_priority};
+
+        const uint32_t index = findIndex( a_context, a_name);
+
+        if ( ( max_number == index) || ( nullptr == a_context.m_entries[ index].mp_name))
+        {
+            return;
+        }
+
+        Entry & entry = a_context.m_entries[ index];
+
+        if ( nullptr != entry.mp_binding)
+        {
+            entry.m_handle = kernel::Handle{};
+            entry.m_registered = false;
+            *entry.mp_binding = kernel::Handle{};
+            return;
+        }
+
+        removeIndex( a_context, index);
+    }
+
+    // Bind a_binding to a_name. It is written at once, if object is already registered.
+    // Return 'false' if registry is full or a_name is already bound to other handle.
+    inline bool bind( Context & a_context, const kernel::Name & a_name, kernel::Handle & a_binding)
+    {
+        assert( nullptr != a_name.mp_string);
+
+        kernel::hardware::CriticalSection critical_section{ critical_section_priority};
+
+        const uint32_t index = findIndex( a_context, a_name);
+
+        if ( max_number == index)
+        {
+            return false;
+        }
+
+        Entry & entry = a_context.m_entries[ index];
+
+        if ( ( nullptr != entry.mp_binding) && ( &a_binding != entry.mp_binding))
+        {
+            return false;
+        }
+
+        if ( nullptr == entry.mp_name)
+        {
+            entry.mp_name = a_name.mp_string;
+            entry.m_hash = a_name.m_hash;
+        }
+
+        entry.mp_binding = &a_binding;
+
+        if ( true == entry.m_registered)
+        {
+            a_binding = entry.m_handle;
+        }
+
+        return true;
+    }
+}
@@ -0,0 +1,175 @@
+#pragma once
+
+#include "config/config.hpp"
+#include "common/memory_buffer.hpp"
+#include "common/memory.hpp"
+#include "hardware/hardware.hpp"
+
+#include "../kernel.hpp"
+
+// Lock-free single producer, single consumer Ring Buffer implementation.
+
+// Ring buffer main usage is data transfer from a single hardware interrupt to a single task.
+// Producer is the only writer of m_head and consumer is the only writer of m_tail, so send
+// and receive never enter critical section and interrupts are never masked.
+// Memory barriers order element data accesses with publishing of the index.
+
+// Indexes are free running and are wrapped with mask on access, so capacity must be a power
+// of two. Full and empty buffer are told apart by indexes difference, so no slot is wasted.
+
+// Note: Only create and destroy modify ring buffer Context and these are called from
+//       task with kernel lock taken.
+namespace kernel::internal::ring_buffer
+{
+    // Type strong index of Ring Buffer.
+    enum class Id : uint32_t{};
+
+    struct RingBuffer
+    {
+        volatile uint32_t   m_head{ 0U}; // Written only by producer.
+        volatile uint32_t   m_tail{ 0U}; // Written only by consumer.
+
+        uint32_t            m_mask{ 0U};
+        size_t              m_data_type_size{ 0U};
+        uint8_t *           mp_data{ nullptr};
+    };
+
+    // Type strong memory index for allocated Ring Buffer type.
+    typedef common::MemoryBuffer< RingBuffer, max_number>::Id MemoryBufferIndex;
+
+    struct Context
+    {
+        common::MemoryBuffer< RingBuffer, max_number> m_data{};
+    };
+
+    // Return 'true' if a_value is a power of two.
+    constexpr bool isPowerOfTwo( size_t a_value)
+    {
+        return ( 0U != a_value) && ( 0U == ( a_value & ( a_value - 1U)));
+    }
+
+    inline bool create(
+        Context &       a_context,
+        Id &            a_id,
+        size_t          a_data_max_elements,
+        size_t          a_data_type_size,
+        void * const    ap_static_buffer
+    )
+    {
+        assert( nullptr != ap_static_buffer);
+        assert( isPowerOfTwo( a_data_max_elements));
+
+        MemoryBufferIndex new_ring_buffer_id;
+
+        if ( false == a_context.m_data.allocate( new_ring_buffer_id))
+        {
+            return false;
+        }
+
+        a_id = static_cast< Id>( new_ring_buffer_id);
+
+        RingBuffer & new_ring_buffer = a_context.m_data.at( new_ring_buffer_id);
+
+        new_ring_buffer.m_head = 0U;
+        new_ring_buffer.m_tail = 0U;
+
+        new_ring_buffer.m_mask = static_cast< uint32_t>( a_data_max_elements - 1U);
+        new_ring_buffer.m_data_type_size = a_data_type_size;
+        new_ring_buffer.mp_data = reinterpret_cast< uint8_t *>( ap_static_buffer);
+
+        return true;
+    }
+
+    inline void destroy( Context & a_context, Id & a_id)
+    {
+        a_context.m_data.free( static_cast< MemoryBufferIndex>( a_id));
+    }
+
+    // Note: Size can be changed by the other side at any time, so result of
+    //       getSize, isEmpty and isFull is only a snapshot.
+    inline size_t getSize( Context & a_context, Id & a_id)
+    {
+        RingBuffer & ring_buffer = a_context.m_data.at( static_cast< MemoryBufferIndex>( a_id));
+
+        return ring_buffer.m_head - ring_buffer.m_tail;
+    }
+
+    inline bool isEmpty( Context & a_context, Id & a_id)
+    {
+        RingBuffer & ring_buffer = a_context.m_data.at( static_cast< MemoryBufferIndex>( a_id));
+
+        return ( ring_buffer.m_head == ring_buffer.m_tail);
+    }
+
+    inline bool isFull( Context & a_context, Id & a_id)
+    {
+        RingBuffer & ring_buffer = a_context.m_data.at( static_cast< MemoryBufferIndex>( a_id));
+
+        return ( getSize( a_context, a_id) > ring_buffer.m_mask);
+    }
+
+    // Push item to the head. Must only be called by producer.
+    inline bool send( Context & a_context, Id & a_id, const void * const ap_data)
+    {
+        assert( nullptr != ap_data);
+
+        RingBuffer & ring_buffer = a_context.m_data.at( static_cast< MemoryBufferIndex>( a_id));
+
+        const uint32_t head = ring_buffer.m_head;
+
+        if ( ( head - ring_buffer.m_tail) > ring_buffer.m_mask)
+        {
+            return false;
+        }
+
+        {
+            const size_t real_head_offset = ring_buffer.m_data_type_size * ( head & ring_buffer.m_mask);
+
+            uint8_t & destination = *( ring_buffer.mp_data + real_head_offset);
+            auto & source = *reinterpret_cast< const uint8_t *>( ap_data);
+
+            memory::copy( destination, source, ring_buffer.m_data_type_size);
+        }
+
+        // Element must be stored before it is published to consumer.
+        hardware::utility::memoryBarrier();
+
+        ring_buffer.m_head = head + 1U;
+
+        return true;
+    }
+
+    // Pop item from the tail. Must only be called by consumer.
+    inline bool receive( Context & a_context, Id & a_id, void * const ap_data)
+    {
+        assert( nullptr != ap_data);
+
+        RingBuffer & ring_buffer = a_context.m_data.at( static_cast< MemoryBufferIndex>( a_id));
+
+        const uint32_t tail = ring_buffer.m_tail;
+
+        if ( ring_buffer.m_head == tail)
+        {
+            return false;
+        }
+
+        // Element must not be loaded before head, which published it.
+        hardware::utility::memoryBarrier();
+
+        {
+            const size_t real_tail_offset = ring_buffer.m_data_type_size * ( tail & ring_buffer.m_mask);
+
+            auto & destination = *reinterpret_cast< uint8_t *>( ap_data);
+            const uint8_t & source = *( ring_buffer.mp_data + real_tail_offset);
+
+            memory::copy( destination, source, ring_buffer.m_data_type_size);
+        }
+
+        // Element must be loaded before its slot is released to producer.
+        hardware::utility::memoryBarrier();
+
+        ring_buffer.m_tail = tail + 1U;
+
+        return true;
+    }
+}
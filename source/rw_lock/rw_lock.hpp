@@ -0,0 +1,189 @@
+#pragma once
+
+#include "config/config.hpp"
+#include "common/memory_buffer.hpp"
+
+#include "../kernel.hpp"
+
+// Reader-writer lock implementation.
+
+// Lock is held by any number of readers or by single writer. Read lock can be tried by
+// hardware interrupts, so hardware level critical sections are used for context access.
+// Lock is taken at once when it is available, so scheduler is only entered when task
+// has to wait.
+
+// Writers, which wait for the lock, are counted. With PreferWriter policy new readers
+// are not let in while the count is not zero, so writers are not starved by readers.
+namespace kernel::internal::rw_lock
+{
+    // Type strong index of Reader-Writer lock.
+    enum class Id : uint32_t{};
+
+    struct RwLock
+    {
+        uint32_t                    m_readers{ 0U};
+        uint32_t                    m_waiting_writers{ 0U};
+        bool                        m_is_written{ false};
+        kernel::rw_lock::Policy     m_policy{ kernel::rw_lock::Policy::PreferWriter};
+    };
+
+    // Type strong memory index for allocated Reader-Writer lock type.
+    typedef common::MemoryBuffer< RwLock, max_number>::Id MemoryBufferIndex;
+
+    struct Context
+    {
+        common::MemoryBuffer< RwLock, max_number> m_data{};
+    };
+
+    inline bool create( Context & a_context, Id & a_id, kernel::rw_lock::Policy a_policy)
+    {
+        kernel::hardware::CriticalSection critical_section{ critical_section_priority};
+
+        MemoryBufferIndex new_lock_id;
+
+        if ( false == a_context.m_data.allocate( new_lock_id))
+        {
+            return false;
+        }
+
+        a_id = static_cast< Id>( new_lock_id);
+
+        RwLock & new_lock = a_context.m_data.at( new_lock_id);
+
+        new_lock.m_readers = 0U;
+        new_lock.m_waiting_writers = 0U;
+        new_lock.m_is_written = false;
+        new_lock.m_policy = a_policy;
+
+        return true;
+    }
+
+    inline void destroy( Context & a_context, Id & a_id)
+    {
+        kernel::hardware::CriticalSection critical_section{ critical_section_priority};
+
+        a_context.m_data.free( static_cast< MemoryBufferIndex>( a_id));
+    }
+
+    inline bool isReadAvailable( const RwLock & a_lock)
+    {
+        if ( true == a_lock.m_is_written)
+        {
+            return false;
+        }
+
+        return ( kernel::rw_lock::Policy::PreferReader == a_lock.m_policy) || ( 0U == a_lock.m_waiting_writers);
+    }
+
+    inline bool isWriteAvailable( const RwLock & a_lock)
+    {
+        return ( false == a_lock.m_is_written) && ( 0U == a_lock.m_readers);
+    }
+
+    inline bool isReadAvailable( Context & a_context, Id & a_id)
+    {
+        kernel::hardware::CriticalSection critical_section{ critical_section_priority};
+
+        return isReadAvailable( a_context.m_data.at( static_cast< MemoryBufferIndex>( a_id)));
+    }
+
+    inline bool isWriteAvailable( Context & a_context, Id & a_id)
+    {
+        kernel::hardware::CriticalSection critical_section{ critical_section_priority};
+
+        return isWriteAvailable( a_context.m_data.at( static_cast< MemoryBufferIndex>( a_id)));
+    }
+
+    // Return 'false' if lock is written or, with PreferWriter policy, writer waits for it.
+    inline bool tryLockRead( Context & a_context, Id & a_id)
+    {
+        kernel::hardware::CriticalSection critical_section{ critical_section_priority};
+
+        RwLock & lock = a_context.m_data.at( static_cast< MemoryBufferIndex>( a_id));
+
+        if ( false == isReadAvailable( lock))
+        {
+            return false;
+        }
+
+        ++lock.m_readers;
+
+        return true;
+    }
+
+    // Return 'false' if lock is read or written.
+    inline bool tryLockWrite( Context & a_context, Id & a_id)
+    {
+        kernel::hardware::CriticalSection critical_section{ critical_section_priority};
+
+        RwLock & lock = a_context.m_data.at( static_cast< MemoryBufferIndex>( a_id));
+
+        if ( false == isWriteAvailable( lock))
+        {
+            return false;
+        }
+
+        lock.m_is_written = true;
+
+        return true;
+    }
+
+    // Return 'false' if lock was not read.
+    inline bool unlockRead( Context & a_context, Id & a_id)
+    {
+        kernel::hardware::CriticalSection critical_section{ critical_section_priority};
+
+        RwLock & lock = a_context.m_data.at( static_cast< MemoryBufferIndex>( a_id));
+
+        if ( 0U == lock.m_readers)
+        {
+            return false;
+        }
+
+        --lock.m_readers;
+
+        return true;
+    }
+
+    // Return 'false' if lock was not written.
+    inline bool unlockWrite( Context & a_context, Id & a_id)
+    {
+        kernel::hardware::CriticalSection critical_section{ critical_section_priority};
+
+        RwLock & lock = a_context.m_data.at( static_cast< MemoryBufferIndex>( a_id));
+
+        if ( false == lock.m_is_written)
+        {
+            return false;
+        }
+
+        lock.m_is_written = false;
+
+        return true;
+    }
+
+    inline void addWaitingWriter( Context & a_context, Id & a_id)
+    {
+        kernel::hardware::CriticalSection critical_section{ critical_section_priority};
+
+        ++a_context.m_data.at( static_cast< MemoryBufferIndex>( a_id)).m_waiting_writers;
+    }
+
+    inline void removeWaitingWriter( Context & a_context, Id & a_id)
+    {
+        kernel::hardware::CriticalSection critical_section{ critical_section_priority};
+
+        RwLock & lock = a_context.m_data.at( static_cast< MemoryBufferIndex>( a_id));
+
+        assert( lock.m_waiting_writers > 0U);
+
+        --lock.m_waiting_writers;
+    }
+
+    inline uint32_t getReaders( Context & a_context, Id & a_id)
+    {
+        kernel::hardware::CriticalSection critical_section{ critical_section_priority};
+
+        return a_context.m_data.at( static_cast< MemoryBufferIndex>( a_id)).m_readers;
+    }
+}
@@ -26,7 +26,7 @@ namespace kernel::internal::scheduler::ready_list
 
     struct Context
     {
-        volatile TaskList m_ready_list[ internal::task::priorities_count]{};
+        TaskList m_ready_list[ internal::task::priorities_count]{};
     };
 
     inline bool addTask(
@@ -19,8 +19,8 @@ namespace kernel::internal::scheduler
     {
         // Note: by design, Idle task must always be available,
         //       has Id = 0 and Idle priority. Otherwise UB.
-        volatile kernel::internal::task::Id m_current{ 0U};
-        volatile kernel::internal::task::Id m_next{ 0U};
+        kernel::internal::task::Id m_current{ 0U};
+        kernel::internal::task::Id m_next{ 0U};
 
         // Ready list.
         ready_list::Context m_ready_list{};
@@ -207,6 +207,98 @@ namespace kernel::internal::scheduler
         wait_list::removeTask( a_context.m_wait_list, a_task_id);
     }
 
+    // Wake up Waiting task, which wait condition was fulfilled directly by another task,
+    // without waiting for the next system tick to check it.
+    // Return 'false' if task is not Waiting.
+    inline bool wakeWaitingTask(
+        Context &                   a_context,
+        internal::task::Context &   a_task_context,
+        task::Id &                  a_task_id,
+        kernel::sync::WaitResult    a_wait_result,
+        uint32_t                    a_signaled_item_index
+    )
+    {
+        const auto task_state = kernel::internal::task::state::get( a_task_context, a_task_id);
+
+        if ( kernel::task::State::Waiting != task_state)
+        {
+            return false;
+        }
+
+        wait_list::removeTask( a_context.m_wait_list, a_task_id);
+
+        bool task_added = addReadyTask( a_context, a_task_context, a_task_id);
+
+        if ( true == task_added)
+        {
+            kernel::internal::task::state::set(
+                a_task_context,
+                a_task_id,
+                kernel::task::State::Ready
+            );
+
+            task::wait::result::set( a_task_context, a_task_id, a_wait_result);
+            task::wait::last_signal_index::set( a_task_context, a_task_id, a_signaled_item_index);
+        }
+
+        return task_added;
+    }
+
+    // Find the highest priority task waiting for a_handle. Tasks of the same priority
+    // are found in wait list order.
+    inline bool findWaitingTask(
+        Context &                   a_context,
+        internal::task::Context &   a_task_context,
+        const kernel::Handle &      a_handle,
+        task::Id &                  a_task_id
+    )
+    {
+        bool task_found = false;
+        uint32_t found_priority = kernel::internal::task::priorities_count;
+
+        for ( uint32_t i = 0U; i < kernel::internal::task::max_number; ++i)
+        {
+            auto & wait_items = a_context.m_wait_list.m_list;
+            auto wait_item_index = static_cast< wait_list::MemoryBufferIndex> ( i);
+
+            if ( false == wait_items.isAllocated( wait_item_index))
+            {
+                continue;
+            }
+
+            const auto & wait_item = wait_items.at( wait_item_index);
+            const auto & conditions = wait_item.m_conditions;
+
+            if ( wait::Type::WaitForObj != conditions.m_type)
+            {
+                continue;
+            }
+
+            for ( uint32_t signal = 0U; signal < conditions.m_numberOfSignals; ++signal)
+            {
+                if ( a_handle != conditions.m_waitSignals[ signal])
+                {
+                    continue;
+                }
+
+                const auto priority = static_cast< uint32_t>(
+                    kernel::internal::task::priority::get( a_task_context, wait_item.m_id)
+                );
+
+                if ( priority < found_priority)
+                {
+                    found_priority = priority;
+                    a_task_id = wait_item.m_id;
+                    task_found = true;
+                }
+
+                break;
+            }
+        }
+
+        return task_found;
+    }
+
     inline bool getNextTask(
         Context &                   a_context,
         internal::task::Context &   a_task_context,
@@ -293,6 +385,51 @@ namespace kernel::internal::scheduler
         return next_task_found;
     }
 
+    // Make the first Ready task of priority higher than current task Running.
+    // Return 'false' if there is no such task, so current task keeps running.
+    inline bool preemptCurrentTask(
+        Context &                   a_context,
+        internal::task::Context &   a_task_context,
+        task::Id &                  a_next_task_id
+    )
+    {
+        const auto current_priority = kernel::internal::task::priority::get( a_task_context, a_context.m_current);
+
+        // Iterate over priority lists higher than current task priority, starting from highest.
+        uint32_t priority = static_cast< uint32_t>( kernel::task::Priority::High);
+
+        for ( ; priority < static_cast< uint32_t>( current_priority); ++priority)
+        {
+            bool task_found = ready_list::findCurrentTask(
+                a_context.m_ready_list,
+                static_cast< kernel::task::Priority>( priority),
+                a_next_task_id
+            );
+
+            if ( task_found)
+            {
+                kernel::internal::task::state::set(
+                    a_task_context,
+                    a_context.m_current,
+                    kernel::task::State::Ready
+                );
+
+                kernel::internal::task::state::set(
+                    a_task_context,
+                    a_next_task_id,
+                    kernel::task::State::Running
+                );
+
+                a_context.m_next = a_next_task_id;
+                a_context.m_current = a_next_task_id;
+
+                return true;
+            }
+        }
+
+        return false;
+    }
+
     inline task::Id getCurrentTaskId( Context & a_context)
     {
         return a_context.m_current;
@@ -310,9 +447,7 @@ namespace kernel::internal::scheduler
     inline void checkWaitConditions(
         Context &                   a_context,
         internal::task::Context &   a_task_context,
-        internal::timer::Context &  a_timer_context,
-        internal::event::Context &  a_event_context,
-        internal::queue::Context &  a_queue_context,
+        handle::Context &           a_object_context,
         TimeMs &                    a_current
     )
     {
@@ -333,9 +468,7 @@ namespace kernel::internal::scheduler
                 bool is_condition_fulfilled =
                     wait::check(
                         conditions,
-                        a_timer_context,
-                        a_event_context,
-                        a_queue_context,
+                        a_object_context,
                         a_wait_result,
                         a_current,
                         signaled_item_index
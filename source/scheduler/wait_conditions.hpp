@@ -2,9 +2,6 @@
 
 #include "config/config.hpp"
 
-#include "timer/timer.hpp"
-#include "event/event.hpp"
-#include "queue/queue.hpp"
 #include "handle/handle.hpp"
 
 // This is data structure holding task wait conditions.
@@ -40,7 +37,7 @@ namespace kernel::internal::scheduler::wait
     };
 
     inline void initSleep(
-        volatile Conditions &   a_conditions_context,
+        Conditions &            a_conditions_context,
         TimeMs &                a_interval,
         TimeMs &                a_current
     )
@@ -51,7 +48,7 @@ namespace kernel::internal::scheduler::wait
     }
 
     inline bool initWaitForObj(
-        volatile Conditions &   a_conditions_context,
+        Conditions &            a_conditions_context,
         kernel::Handle *        a_wait_signals,
         uint32_t                a_number_of_signals,
         bool &                  a_wait_for_all_signals,
@@ -88,14 +85,13 @@ namespace kernel::internal::scheduler::wait
 
     // Test and UPDATE wait signals depending on provided context.
     inline bool testWaitSignals(
-        internal::timer::Context &  a_timer_context,
-        internal::event::Context &  a_event_context,
-        internal::queue::Context &  a_queue_context,
+        handle::Context &           a_object_context,
         kernel::sync::WaitResult &  a_result,
-        volatile kernel::Handle *   a_wait_signals,
+        const kernel::Handle *      a_wait_signals,
         uint32_t                    a_number_of_signals,
-        volatile bool &             a_wait_for_all_signals,
-        uint32_t &                  a_signaled_item_index
+        bool                        a_wait_for_all_signals,
+        uint32_t &                  a_signaled_item_index,
+        TimeMs                      a_current
     )
     {
         bool condition_fulfilled = true;
@@ -105,11 +101,10 @@ namespace kernel::internal::scheduler::wait
         for ( uint32_t i = 0U; i < a_number_of_signals; ++i)
         {
             const bool valid_handle = handle::testCondition(
-                a_timer_context,
-                a_event_context,
-                a_queue_context,
+                a_object_context,
                 a_wait_signals[ i],
-                condition_fulfilled
+                condition_fulfilled,
+                a_current
             );
 
             if ( false == valid_handle)
@@ -127,7 +122,7 @@ namespace kernel::internal::scheduler::wait
             {
                 if ( true == condition_fulfilled)
                 {
-                    handle::resetState( a_timer_context, a_event_context, a_wait_signals[ i]);
+                    handle::resetState( a_object_context, a_wait_signals[ i]);
                     
                     a_signaled_item_index = i;
                     a_result = kernel::sync::WaitResult::ObjectSet;
@@ -161,7 +156,7 @@ namespace kernel::internal::scheduler::wait
                 // Reset all system objects pointed by a_wait_signals.
                 for ( uint32_t i = 0U; i < a_number_of_signals; ++i)
                 {
-                    handle::resetState( a_timer_context, a_event_context, a_wait_signals[ i]);
+                    handle::resetState( a_object_context, a_wait_signals[ i]);
                 }
                 a_result = kernel::sync::WaitResult::ObjectSet;
                 return true;
@@ -172,10 +167,8 @@ namespace kernel::internal::scheduler::wait
     }
 
     inline bool check(
-        volatile Conditions &       a_conditions_context,
-        internal::timer::Context &  a_timer_context,
-        internal::event::Context &  a_event_context,
-        internal::queue::Context &  a_queue_context,
+        Conditions &                a_conditions_context,
+        handle::Context &           a_object_context,
         kernel::sync::WaitResult &  a_result,
         TimeMs &                    a_current,
         uint32_t &                  a_signaled_item_index
@@ -207,14 +200,13 @@ namespace kernel::internal::scheduler::wait
             }
 
             bool condition_fulfilled = testWaitSignals(
-                a_timer_context,
-                a_event_context,
-                a_queue_context,
+                a_object_context,
                 a_result,
                 a_conditions_context.m_waitSignals,
                 a_conditions_context.m_numberOfSignals,
                 a_conditions_context.m_waitForAllSignals,
-                a_signaled_item_index
+                a_signaled_item_index,
+                a_current
             );
 
             return condition_fulfilled;
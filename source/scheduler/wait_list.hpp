@@ -28,7 +28,7 @@ namespace kernel::internal::scheduler::wait_list
     struct Context
     {
         // TODO: consider this a list to reduce search iterations.
-        volatile common::MemoryBuffer<
+        common::MemoryBuffer<
             WaitItem,
             task::max_number
         > m_list{};
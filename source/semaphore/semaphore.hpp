@@ -0,0 +1,113 @@
+#pragma once
+
+#include "config/config.hpp"
+#include "common/memory_buffer.hpp"
+
+#include "../kernel.hpp"
+
+// Counting semaphore implementation.
+
+// Semaphore is given by tasks and hardware interrupts, so hardware level critical sections are
+// used for context access. Take succeeds at once when count is positive, so scheduler is only
+// entered when task has to wait.
+namespace kernel::internal::semaphore
+{
+    // Type strong index of Semaphore.
+    enum class Id : uint32_t{};
+
+    struct Semaphore
+    {
+        uint32_t    m_count{ 0U};
+        uint32_t    m_max_count{ 0U};
+    };
+
+    // Type strong memory index for allocated Semaphore type.
+    typedef common::MemoryBuffer< Semaphore, max_number>::Id MemoryBufferIndex;
+
+    struct Context
+    {
+        common::MemoryBuffer< Semaphore, max_number> m_data{};
+    };
+
+    inline bool create(
+        Context &   a_context,
+        Id &        a_id,
+        uint32_t    a_max_count,
+        uint32_t    a_initial_count
+    )
+    {
+        assert( a_max_count > 0U);
+        assert( a_initial_count <= a_max_count);
+
+        kernel::hardware::CriticalSection critical_section{ critical_section_priority};
+
+        MemoryBufferIndex new_semaphore_id;
+
+        if ( false == a_context.m_data.allocate( new_semaphore_id))
+        {
+            return false;
+        }
+
+        a_id = static_cast< Id>( new_semaphore_id);
+
+        Semaphore & new_semaphore = a_context.m_data.at( new_semaphore_id);
+
+        new_semaphore.m_count = a_initial_count;
+        new_semaphore.m_max_count = a_max_count;
+
+        return true;
+    }
+
+    inline void destroy( Context & a_context, Id & a_id)
+    {
+        kernel::hardware::CriticalSection critical_section{ critical_section_priority};
+
+        a_context.m_data.free( static_cast< MemoryBufferIndex>( a_id));
+    }
+
+    // Return 'false' if count already reached its maximum.
+    inline bool give( Context & a_context, Id & a_id)
+    {
+        kernel::hardware::CriticalSection critical_section{ critical_section_priority};
+
+        Semaphore & semaphore = a_context.m_data.at( static_cast< MemoryBufferIndex>( a_id));
+
+        if ( semaphore.m_count >= semaphore.m_max_count)
+        {
+            return false;
+        }
+
+        ++semaphore.m_count;
+
+        return true;
+    }
+
+    // Return 'false' if count is zero.
+    inline bool take( Context & a_context, Id & a_id)
+    {
+        kernel::hardware::CriticalSection critical_section{ critical_section_priority};
+
+        Semaphore & semaphore = a_context.m_data.at( static_cast< MemoryBufferIndex>( a_id));
+
+        if ( 0U == semaphore.m_count)
+        {
+            return false;
+        }
+
+        --semaphore.m_count;
+
+        return true;
+    }
+
+    inline uint32_t getCount( Context & a_context, Id & a_id)
+    {
+        kernel::hardware::CriticalSection critical_section{ critical_section_priority};
+
+        return a_context.m_data.at( static_cast< MemoryBufferIndex>( a_id)).m_count;
+    }
+
+    inline bool isAvailable( Context & a_context, Id & a_id)
+    {
+        return ( 0U != getCount( a_context, a_id));
+    }
+}
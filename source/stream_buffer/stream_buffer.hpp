@@ -0,0 +1,351 @@
+#pragma once
+
+#include "config/config.hpp"
+#include "common/memory_buffer.hpp"
+#include "common/memory.hpp"
+
+#include "../kernel.hpp"
+
+// Stream Buffer and Message Buffer implementation.
+
+// Both are byte rings over single static buffer. Stream buffer moves any number of bytes
+// per call, without any framing. Message buffer stores each message with its length prefix,
+// so variable size messages are received whole, the same way they were sent.
+
+// Reader is woken up (buffer is signaled) when number of stored data bytes reaches trigger
+// level, or when buffer is full, so writer can never block reader. Length prefixes of
+// messages are not counted to trigger level.
+
+// As with static queue, it can be used by hardware interrupts, so hardware level critical
+// sections are used for context access.
+namespace kernel::internal::stream_buffer
+{
+    // Type strong index of Stream Buffer.
+    enum class Id : uint32_t{};
+
+    // Length prefix of message stored in Message Buffer.
+    typedef uint16_t MessageLength;
+
+    constexpr size_t max_message_length{ 0xFFFFU};
+
+    struct StreamBuffer
+    {
+        size_t      m_current_size{ 0U};        // Stored bytes, including length prefixes.
+        size_t      m_number_of_messages{ 0U};
+        uint32_t    m_head{ 0U};
+        uint32_t    m_tail{ 0U};
+
+        size_t      m_capacity{ 0U};
+        size_t      m_trigger_level{ 1U};
+        uint8_t *   mp_data{ nullptr};
+
+        bool        m_is_message_buffer{ false};
+    };
+
+    // Type strong memory index for allocated Stream Buffer type.
+    typedef common::MemoryBuffer< StreamBuffer, max_number>::Id MemoryBufferIndex;
+
+    struct Context
+    {
+        common::MemoryBuffer< StreamBuffer, max_number> m_data{};
+    };
+
+    inline bool create(
+        Context &       a_context,
+        Id &            a_id,
+        size_t          a_capacity,
+        void * const    ap_static_buffer,
+        size_t          a_trigger_level,
+        bool            a_is_message_buffer
+    )
+    {
+        assert( nullptr != ap_static_buffer);
+        assert( a_trigger_level > 0U);
+
+        kernel::hardware::CriticalSection critical_section{ critical_section_priority};
+
+        MemoryBufferIndex new_buffer_id;
+
+        if ( false == a_context.m_data.allocate( new_buffer_id))
+        {
+            return false;
+        }
+
+        a_id = static_cast< Id>( new_buffer_id);
+
+        StreamBuffer & new_buffer = a_context.m_data.at( new_buffer_id);
+
+        new_buffer.m_current_size = 0U;
+        new_buffer.m_number_of_messages = 0U;
+        new_buffer.m_head = 0U;
+        new_buffer.m_tail = 0U;
+
+        new_buffer.m_capacity = a_capacity;
+        new_buffer.m_trigger_level = a_trigger_level;
+        new_buffer.mp_data = reinterpret_cast< uint8_t *>( ap_static_buffer);
+
+        new_buffer.m_is_message_buffer = a_is_message_buffer;
+
+        return true;
+    }
+
+    inline void destroy( Context & a_context, Id & a_id)
+    {
+        kernel::hardware::CriticalSection critical_section{ critical_section_priority};
+
+        a_context.m_data.free( static_cast< MemoryBufferIndex>( a_id));
+    }
+
+    inline bool isMessageBuffer( Context & a_context, Id & a_id)
+    {
+        kernel::hardware::CriticalSection critical_section{ critical_section_priority};
+
+        return a_context.m_data.at( static_cast< MemoryBufferIndex>( a_id)).m_is_message_buffer;
+    }
+
+    inline void setTriggerLevel( Context & a_context, Id & a_id, size_t a_trigger_level)
+    {
+        assert( a_trigger_level > 0U);
+
+        kernel::hardware::CriticalSection critical_section{ critical_section_priority};
+
+        a_context.m_data.at( static_cast< MemoryBufferIndex>( a_id)).m_trigger_level = a_trigger_level;
+    }
+
+    // Number of stored data bytes, without length prefixes.
+    // Note: Must be called with critical section taken.
+    inline size_t getDataSize( const StreamBuffer & a_buffer)
+    {
+        return a_buffer.m_current_size - ( a_buffer.m_number_of_messages * sizeof( MessageLength));
+    }
+
+    inline size_t getSize( Context & a_context, Id & a_id)
+    {
+        kernel::hardware::CriticalSection critical_section{ critical_section_priority};
+
+        return getDataSize( a_context.m_data.at( static_cast< MemoryBufferIndex>( a_id)));
+    }
+
+    // Return 'true' if no more bytes can be written. Used by blocking stream buffer send.
+    inline bool isFull( Context & a_context, Id & a_id)
+    {
+        kernel::hardware::CriticalSection critical_section{ critical_section_priority};
+
+        const StreamBuffer & buffer = a_context.m_data.at( static_cast< MemoryBufferIndex>( a_id));
+
+        return buffer.m_current_size >= buffer.m_capacity;
+    }
+
+    // Return 'true' if reader should be woken up.
+    inline bool isTriggered( Context & a_context, Id & a_id)
+    {
+        kernel::hardware::CriticalSection critical_section{ critical_section_priority};
+
+        const StreamBuffer & buffer = a_context.m_data.at( static_cast< MemoryBufferIndex>( a_id));
+
+        if ( 0U == buffer.m_current_size)
+        {
+            return false;
+        }
+
+        // Next message does not fit in full message buffer, even if it has single byte.
+        const size_t full_size = buffer.m_is_message_buffer ?
+            ( buffer.m_capacity - sizeof( MessageLength)) :
+            buffer.m_capacity;
+
+        return ( getDataSize( buffer) >= buffer.m_trigger_level) || ( buffer.m_current_size >= full_size);
+    }
+
+    // Copy bytes to ring starting from a_index, in at most two blocks around buffer end.
+    // Return index following the last written byte.
+    // Note: Must be called with critical section taken.
+    inline uint32_t write( StreamBuffer & a_buffer, uint32_t a_index, const uint8_t * ap_source, size_t a_number_of_bytes)
+    {
+        const size_t first_block_size = ( a_number_of_bytes < ( a_buffer.m_capacity - a_index)) ?
+            a_number_of_bytes :
+            ( a_buffer.m_capacity - a_index);
+
+        if ( first_block_size > 0U)
+        {
+            memory::copy( *( a_buffer.mp_data + a_index), *ap_source, first_block_size);
+        }
+
+        if ( a_number_of_bytes > first_block_size)
+        {
+            memory::copy( *a_buffer.mp_data, *( ap_source + first_block_size), a_number_of_bytes - first_block_size);
+        }
+
+        a_index += static_cast< uint32_t>( a_number_of_bytes);
+
+        if ( a_index >= a_buffer.m_capacity)
+        {
+            a_index -= static_cast< uint32_t>( a_buffer.m_capacity);
+        }
+
+        return a_index;
+    }
+
+    // Copy bytes from ring starting from a_index, in at most two blocks around buffer end.
+    // Return index following the last read byte.
+    // Note: Must be called with critical section taken.
+    inline uint32_t read( const StreamBuffer & a_buffer, uint32_t a_index, uint8_t * ap_destination, size_t a_number_of_bytes)
+    {
+        const size_t first_block_size = ( a_number_of_bytes < ( a_buffer.m_capacity - a_index)) ?
+            a_number_of_bytes :
+            ( a_buffer.m_capacity - a_index);
+
+        if ( first_block_size > 0U)
+        {
+            memory::copy( *ap_destination, *( a_buffer.mp_data + a_index), first_block_size);
+        }
+
+        if ( a_number_of_bytes > first_block_size)
+        {
+            memory::copy( *( ap_destination + first_block_size), *a_buffer.mp_data, a_number_of_bytes - first_block_size);
+        }
+
+        a_index += static_cast< uint32_t>( a_number_of_bytes);
+
+        if ( a_index >= a_buffer.m_capacity)
+        {
+            a_index -= static_cast< uint32_t>( a_buffer.m_capacity);
+        }
+
+        return a_index;
+    }
+
+    // Write up to a_number_of_bytes bytes. Return number of bytes written.
+    inline size_t send( Context & a_context, Id & a_id, const void * const ap_data, size_t a_number_of_bytes)
+    {
+        assert( nullptr != ap_data);
+
+        kernel::hardware::CriticalSection critical_section{ critical_section_priority};
+
+        StreamBuffer & buffer = a_context.m_data.at( static_cast< MemoryBufferIndex>( a_id));
+
+        if ( true == buffer.m_is_message_buffer)
+        {
+            return 0U;
+        }
+
+        const size_t free_size = buffer.m_capacity - buffer.m_current_size;
+        const size_t bytes_to_send = ( a_number_of_bytes < free_size) ? a_number_of_bytes : free_size;
+
+        buffer.m_head = write( buffer, buffer.m_head, reinterpret_cast< const uint8_t *>( ap_data), bytes_to_send);
+        buffer.m_current_size += bytes_to_send;
+
+        return bytes_to_send;
+    }
+
+    // Read up to a_number_of_bytes bytes. Return number of bytes read.
+    inline size_t receive( Context & a_context, Id & a_id, void * const ap_data, size_t a_number_of_bytes)
+    {
+        assert( nullptr != ap_data);
+
+        kernel::hardware::CriticalSection critical_section{ critical_section_priority};
+
+        StreamBuffer & buffer = a_context.m_data.at( static_cast< MemoryBufferIndex>( a_id));
+
+        if ( true == buffer.m_is_message_buffer)
+        {
+            return 0U;
+        }
+
+        const size_t bytes_to_receive = ( a_number_of_bytes < buffer.m_current_size) ? a_number_of_bytes : buffer.m_current_size;
+
+        buffer.m_tail = read( buffer, buffer.m_tail, reinterpret_cast< uint8_t *>( ap_data), bytes_to_receive);
+        buffer.m_current_size -= bytes_to_receive;
+
+        return bytes_to_receive;
+    }
+
+    // Write whole message with its length prefix. Return 'false' if it does not fit.
+    inline bool sendMessage( Context & a_context, Id & a_id, const void * const ap_data, size_t a_length)
+    {
+        assert( nullptr != ap_data);
+
+        kernel::hardware::CriticalSection critical_section{ critical_section_priority};
+
+        StreamBuffer & buffer = a_context.m_data.at( static_cast< MemoryBufferIndex>( a_id));
+
+        if ( ( false == buffer.m_is_message_buffer) || ( 0U == a_length) || ( a_length > max_message_length))
+        {
+            return false;
+        }
+
+        if ( ( sizeof( MessageLength) + a_length) > ( buffer.m_capacity - buffer.m_current_size))
+        {
+            return false;
+        }
+
+        const MessageLength length = static_cast< MessageLength>( a_length);
+
+        buffer.m_head = write( buffer, buffer.m_head, reinterpret_cast< const uint8_t *>( &length), sizeof( length));
+        buffer.m_head = write( buffer, buffer.m_head, reinterpret_cast< const uint8_t *>( ap_data), a_length);
+
+        buffer.m_current_size += sizeof( MessageLength) + a_length;
+        ++buffer.m_number_of_messages;
+
+        return true;
+    }
+
+    // Return length of the oldest message, or 0 if there is no message.
+    // Note: Must be called with critical section taken.
+    inline size_t getNextMessageLength( const StreamBuffer & a_buffer)
+    {
+        if ( 0U == a_buffer.m_number_of_messages)
+        {
+            return 0U;
+        }
+
+        MessageLength length = 0U;
+
+        ( void) read( a_buffer, a_buffer.m_tail, reinterpret_cast< uint8_t *>( &length), sizeof( length));
+
+        return length;
+    }
+
+    inline size_t getNextMessageLength( Context & a_context, Id & a_id)
+    {
+        kernel::hardware::CriticalSection critical_section{ critical_section_priority};
+
+        return getNextMessageLength( a_context.m_data.at( static_cast< MemoryBufferIndex>( a_id)));
+    }
+
+    // Read the oldest message. Return its length, or 0 if there is no message or it is longer
+    // than a_max_length. Message, which does not fit, is left in buffer.
+    inline size_t receiveMessage( Context & a_context, Id & a_id, void * const ap_data, size_t a_max_length)
+    {
+        assert( nullptr != ap_data);
+
+        kernel::hardware::CriticalSection critical_section{ critical_section_priority};
+
+        StreamBuffer & buffer = a_context.m_data.at( static_cast< MemoryBufferIndex>( a_id));
+
+        if ( false == buffer.m_is_message_buffer)
+        {
+            return 0U;
+        }
+
+        const size_t length = getNextMessageLength( buffer);
+
+        if ( ( 0U == length) || ( length > a_max_length))
+        {
+            return 0U;
+        }
+
+        uint32_t data_index = buffer.m_tail + static_cast< uint32_t>( sizeof( MessageLength));
+
+        if ( data_index >= buffer.m_capacity)
+        {
+            data_index -= static_cast< uint32_t>( buffer.m_capacity);
+        }
+
+        buffer.m_tail = read( buffer, data_index, reinterpret_cast< uint8_t *>( ap_data), length);
+
+        buffer.m_current_size -= sizeof( MessageLength) + length;
+        --buffer.m_number_of_messages;
+
+        return length;
+    }
+}
@@ -26,6 +26,12 @@ namespace kernel::internal::task
         // Results from Wait for Object function.
         kernel::sync::WaitResult        m_result;
         uint32_t                        m_last_signal_index;
+
+        // Notification value, which can be changed by other tasks and interrupts. It is changed
+        // only in hardware critical section, which is also compiler barrier. Waiting flag is
+        // written by the task itself, before and after it takes the value.
+        uint32_t                        m_notification_value;
+        bool                            m_is_notification_waiting;
     };
 
     // Type strong memory index for allocated Task type.
@@ -33,7 +39,7 @@ namespace kernel::internal::task
 
     struct Context
     {
-        volatile common::MemoryBuffer< Task, max_number> m_data{};
+        common::MemoryBuffer< Task, max_number> m_data{};
     };
 
     typedef void( *TaskRoutine)( void);
@@ -63,13 +69,15 @@ namespace kernel::internal::task
         }
         
         // Initialize new Task object.
-        volatile Task & new_task = a_context.m_data.at( new_item_id);
+        Task & new_task = a_context.m_data.at( new_item_id);
         
         new_task.m_priority = a_priority;
         new_task.m_routine = a_routine;
         new_task.m_stack.init( reinterpret_cast< uint32_t>( a_task_routine));
         new_task.m_sp = new_task.m_stack.getStackPointer();
         new_task.m_parameter = a_parameter;
+        new_task.m_notification_value = 0U;
+        new_task.m_is_notification_waiting = false;
         
         if ( true == a_create_suspended)
         {
@@ -96,7 +104,7 @@ namespace kernel::internal::task
 
     namespace priority
     {
-        inline kernel::task::Priority get( Context & a_context, volatile Id & a_id)
+        inline kernel::task::Priority get( Context & a_context, const Id & a_id)
         {
             return a_context.m_data.at( static_cast< MemoryBufferIndex>( a_id)).m_priority;
         }
@@ -109,7 +117,7 @@ namespace kernel::internal::task
             return a_context.m_data.at( static_cast< MemoryBufferIndex>( a_id)).m_state;
         }
 
-        inline void set( Context & a_context, volatile Id & a_id, kernel::task::State a_state )
+        inline void set( Context & a_context, const Id & a_id, kernel::task::State a_state )
         {
             a_context.m_data.at( static_cast< MemoryBufferIndex>( a_id)).m_state = a_state;
         }
@@ -180,4 +188,76 @@ namespace kernel::internal::task
             }
         }
     }
+
+    // Notification value is accessed by interrupts, so hardware critical section is used.
+    namespace notification
+    {
+        // Return notification value before it was changed.
+        inline uint32_t notify(
+            Context &                       a_context,
+            Id &                            a_id,
+            uint32_t                        a_value,
+            kernel::task::NotifyAction      a_action
+        )
+        {
+            kernel::hardware::CriticalSection critical_section{ critical_section_priority};
+
+            Task & task = a_context.m_data.at( static_cast< MemoryBufferIndex>( a_id));
+
+            const uint32_t previous_value = task.m_notification_value;
+
+            switch ( a_action)
+            {
+            case kernel::task::NotifyAction::SetBits:
+                task.m_notification_value = previous_value | a_value;
+                break;
+            case kernel::task::NotifyAction::Increment:
+                task.m_notification_value = previous_value + 1U;
+                break;
+            case kernel::task::NotifyAction::Overwrite:
+                task.m_notification_value = a_value;
+                break;
+            }
+
+            return previous_value;
+        }
+
+        // Store non-zero notification value in a_value and return 'true'. Value is then
+        // cleared, or decremented when a_clear_on_exit is not set.
+        inline bool take( Context & a_context, Id & a_id, bool a_clear_on_exit, uint32_t & a_value)
+        {
+            kernel::hardware::CriticalSection critical_section{ critical_section_priority};
+
+            Task & task = a_context.m_data.at( static_cast< MemoryBufferIndex>( a_id));
+
+            a_value = task.m_notification_value;
+
+            if ( 0U == a_value)
+            {
+                return false;
+            }
+
+            task.m_notification_value = ( true == a_clear_on_exit) ? 0U : ( a_value - 1U);
+
+            return true;
+        }
+
+        // Return 'true' if task waits for notification and its value is not zero.
+        inline bool isPending( Context & a_context, Id & a_id)
+        {
+            const Task & task = a_context.m_data.at( static_cast< MemoryBufferIndex>( a_id));
+
+            return ( true == task.m_is_notification_waiting) && ( 0U != task.m_notification_value);
+        }
+
+        inline bool isWaiting( Context & a_context, Id & a_id)
+        {
+            return a_context.m_data.at( static_cast< MemoryBufferIndex>( a_id)).m_is_notification_waiting;
+        }
+
+        inline void setWaiting( Context & a_context, Id & a_id, bool a_is_waiting)
+        {
+            a_context.m_data.at( static_cast< MemoryBufferIndex>( a_id)).m_is_notification_waiting = a_is_waiting;
+        }
+    }
 }
@@ -5,6 +5,12 @@
 
 #include "../kernel.hpp"
 
+// Software timer implementation.
+
+// Timer is signaled for waitForObject functions, when it reaches its interval. Timer with
+// callback counts its expirations instead, and kernel timer service task calls the callback
+// for each of them, so callback never runs in interrupt. Auto-reload timer is started again
+// from its own deadline, not from the tick it was noticed in, so its period does not drift.
 namespace kernel::internal::timer
 {
     // Type strong index of Timer.
@@ -19,10 +25,15 @@ namespace kernel::internal::timer
 
     struct Timer
     {
-        TimeMs  m_start;
-        TimeMs  m_interval;
-        TimeMs  m_current;
-        State   m_state;
+        TimeMs                      m_start;
+        TimeMs                      m_interval;
+        TimeMs                      m_current;
+        State                       m_state;
+        kernel::timer::Callback     m_callback;
+        void *                      mp_parameter;
+        // Number of expirations, which callback was not called for yet.
+        uint32_t                    m_pending_callbacks;
+        bool                        m_auto_reload;
     };
     
     // Type strong memory index for allocated Timer type.
@@ -30,14 +41,19 @@ namespace kernel::internal::timer
 
     struct Context
     {
-        volatile common::MemoryBuffer< Timer, max_number> m_data{};
+        common::MemoryBuffer< Timer, max_number> m_data{};
+        // Index of timer, which is checked first for pending callback.
+        uint32_t m_next_callback{ 0U};
     };
 
     inline bool create(
-        Context &   a_context,
-        Id &        a_id,
-        TimeMs &    a_start,
-        TimeMs &    a_interval
+        Context &                   a_context,
+        Id &                        a_id,
+        TimeMs &                    a_start,
+        TimeMs &                    a_interval,
+        kernel::timer::Callback     a_callback = nullptr,
+        void * const                ap_parameter = nullptr,
+        bool                        a_auto_reload = false
     )
     {
         kernel::hardware::CriticalSection critical_section{ critical_section_priority};
@@ -53,7 +69,7 @@ namespace kernel::internal::timer
         a_id = static_cast< Id>( new_item_id);
 
         // Initialize new Timer object.
-        volatile Timer & new_timer = a_context.m_data.at( new_item_id);
+        Timer & new_timer = a_context.m_data.at( new_item_id);
 
         new_timer.m_start = a_start;
         new_timer.m_interval = a_interval;
@@ -61,6 +77,11 @@ namespace kernel::internal::timer
 
         new_timer.m_state = State::Stopped;
 
+        new_timer.m_callback = a_callback;
+        new_timer.mp_parameter = ap_parameter;
+        new_timer.m_pending_callbacks = 0U;
+        new_timer.m_auto_reload = a_auto_reload;
+
         return true;
     }
 
@@ -82,17 +103,21 @@ namespace kernel::internal::timer
     {
         kernel::hardware::CriticalSection critical_section{ critical_section_priority};
 
-        volatile Timer & timer = a_context.m_data.at( static_cast< MemoryBufferIndex> ( a_id));
+        Timer & timer = a_context.m_data.at( static_cast< MemoryBufferIndex> ( a_id));
 
         timer.m_start = timer.m_current;
         timer.m_state = State::Started;
     }
 
+    // Callbacks of expirations before stop are not called.
     inline void stop( Context & a_context, Id & a_id)
     {
         kernel::hardware::CriticalSection critical_section{ critical_section_priority};
 
-        a_context.m_data.at( static_cast< MemoryBufferIndex> ( a_id)).m_state = State::Stopped;
+        Timer & timer = a_context.m_data.at( static_cast< MemoryBufferIndex> ( a_id));
+
+        timer.m_state = State::Stopped;
+        timer.m_pending_callbacks = 0U;
     }
 
     inline State getState( Context & a_context, Id & a_id)
@@ -102,24 +127,89 @@ namespace kernel::internal::timer
         return a_context.m_data.at( static_cast< MemoryBufferIndex> ( a_id)).m_state;
     }
 
+    // Take one pending callback of any timer. Return 'false' if there is none.
+    // Search resumes after the last serviced timer, so timer with many pending callbacks
+    // (ie. short auto-reload period) does not delay callbacks of other timers.
+    inline bool takeCallback( Context & a_context, kernel::timer::Callback & a_callback, void * & ap_parameter)
+    {
+        kernel::hardware::CriticalSection critical_section{ critical_section_priority};
+
+        uint32_t index = a_context.m_next_callback;
+
+        for ( uint32_t i = 0U; i < max_number; ++i)
+        {
+            const uint32_t current_index = index;
+
+            ++index;
+
+            if ( index >= max_number)
+            {
+                index = 0U;
+            }
+
+            if ( false == a_context.m_data.isAllocated( static_cast< MemoryBufferIndex> ( current_index)))
+            {
+                continue;
+            }
+
+            Timer & timer = a_context.m_data.at( static_cast< MemoryBufferIndex> ( current_index));
+
+            if ( 0U != timer.m_pending_callbacks)
+            {
+                --timer.m_pending_callbacks;
+
+                a_callback = timer.m_callback;
+                ap_parameter = timer.mp_parameter;
+
+                a_context.m_next_callback = index;
+
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    // Return 'true' if any timer has pending callback.
     // Note: No critical section here, since this function is called from within kernel::internal::tick.
-    inline void tick( Context & a_context, TimeMs & a_current)
+    inline bool tick( Context & a_context, TimeMs & a_current)
     {
+        bool is_callback_pending = false;
+
         for ( uint32_t i = 0U; i < max_number; ++i)
         {
             if ( true == a_context.m_data.isAllocated( static_cast< MemoryBufferIndex> ( i)))
             {
-                volatile Timer & current_timer = a_context.m_data.at( static_cast< MemoryBufferIndex> ( i));
+                Timer & current_timer = a_context.m_data.at( static_cast< MemoryBufferIndex> ( i));
                 current_timer.m_current = a_current;
 
                 if ( State::Started == current_timer.m_state)
                 {
                     if ( ( current_timer.m_current - current_timer.m_start) > current_timer.m_interval)
                     {
-                        current_timer.m_state = State::Finished;
+                        if ( nullptr != current_timer.m_callback)
+                        {
+                            ++current_timer.m_pending_callbacks;
+                        }
+
+                        if ( true == current_timer.m_auto_reload)
+                        {
+                            current_timer.m_start += current_timer.m_interval;
+                        }
+                        else
+                        {
+                            current_timer.m_state = State::Finished;
+                        }
                     }
                 }
+
+                if ( 0U != current_timer.m_pending_callbacks)
+                {
+                    is_callback_pending = true;
+                }
             }
         }
+
+        return is_callback_pending;
     }
 }
@@ -0,0 +1,64 @@
+#include "catch.hpp"
+
+#include "memory.hpp"
+
+namespace
+{
+    // Fill buffer with known pattern, so partial copy can be detected.
+    template< size_t Size>
+    void fill( volatile uint8_t ( &a_buffer)[ Size], uint8_t a_first_value)
+    {
+        for ( size_t i = 0U; i < Size; ++i)
+        {
+            a_buffer[ i] = static_cast< uint8_t>( a_first_value + i);
+        }
+    }
+}
+
+TEST_CASE( "Memory")
+{
+    using namespace kernel::internal;
+
+    SECTION ( "Detect if word-wide copy is possible.")
+    {
+        alignas( 4) uint8_t buffer[ 16];
+
+        REQUIRE( true == memory::isWordCopyPossible( &buffer[ 0], &buffer[ 4], 8U));
+        REQUIRE( false == memory::isWordCopyPossible( &buffer[ 1], &buffer[ 4], 8U));
+        REQUIRE( false == memory::isWordCopyPossible( &buffer[ 0], &buffer[ 6], 8U));
+        REQUIRE( false == memory::isWordCopyPossible( &buffer[ 0], &buffer[ 4], 7U));
+    }
+
+    SECTION ( "Copy aligned and unaligned memory of different sizes.")
+    {
+        // Sizes cover: single byte, single word, block with remainder and unaligned tail.
+        const size_t sizes[] { 1U, 3U, 4U, 8U, 20U, 32U, 33U};
+
+        for ( size_t size : sizes)
+        {
+            for ( size_t offset = 0U; offset < memory::word_size; ++offset)
+            {
+                alignas( 4) volatile uint8_t source[ 40];
+                alignas( 4) volatile uint8_t destination[ 40];
+
+                fill( source, 0x10U);
+                fill( destination, 0xA0U);
+
+                memory::copy( destination[ offset], source[ offset], size);
+
+                for ( size_t i = 0U; i < 40U; ++i)
+                {
+                    if ( i >= offset && i < offset + size)
+                    {
+                        REQUIRE( source[ i] == destination[ i]);
+                    }
+                    else
+                    {
+                        // Memory outside copied range must not be touched.
+                        REQUIRE( static_cast< uint8_t>( 0xA0U + i) == destination[ i]);
+                    }
+                }
+            }
+        }
+    }
+}
@@ -0,0 +1,15 @@
+#pragma once
+
+// User configuration header used by config_test.cpp, passed as KERNEL_CONFIG_FILE.
+// It disables all optional object types, like project which uses only tasks and events.
+#define KERNEL_EVENT_GROUP_MAX_NUMBER 0U
+#define KERNEL_SEMAPHORE_MAX_NUMBER 0U
+#define KERNEL_RW_LOCK_MAX_NUMBER 0U
+#define KERNEL_TIMER_MAX_NUMBER 0U
+#define KERNEL_QUEUE_MAX_NUMBER 0U
+#define KERNEL_RING_BUFFER_MAX_NUMBER 0U
+#define KERNEL_MPSC_QUEUE_MAX_NUMBER 0U
+#define KERNEL_PRIORITY_QUEUE_MAX_NUMBER 0U
+#define KERNEL_STREAM_BUFFER_MAX_NUMBER 0U
+#define KERNEL_QUEUE_SET_MAX_NUMBER 0U
+#define KERNEL_NAME_REGISTRY_SIZE 4U
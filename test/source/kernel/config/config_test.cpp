@@ -0,0 +1,76 @@
+#include "catch.hpp"
+
+// This test unit is built with its own kernel configuration, like a project overriding
+// defaults. It includes only configuration and memory buffer, so it shares no inline kernel
+// function with other test units, which are built with default configuration.
+
+// Test project enables optional object types and name registry for all units, so drop them
+// here and let the user header set them.
+#undef KERNEL_EVENT_GROUP_MAX_NUMBER
+#undef KERNEL_SEMAPHORE_MAX_NUMBER
+#undef KERNEL_RW_LOCK_MAX_NUMBER
+#undef KERNEL_RING_BUFFER_MAX_NUMBER
+#undef KERNEL_MPSC_QUEUE_MAX_NUMBER
+#undef KERNEL_PRIORITY_QUEUE_MAX_NUMBER
+#undef KERNEL_STREAM_BUFFER_MAX_NUMBER
+#undef KERNEL_QUEUE_SET_MAX_NUMBER
+#undef KERNEL_NAME_REGISTRY_SIZE
+
+// User header is found relative to source/config/config.hpp.
+#define KERNEL_CONFIG_FILE "../../test/source/kernel/config/config_override.hpp"
+
+// Option defined by build system.
+#define KERNEL_TASK_MAX_NUMBER 4U
+
+#include "config/config.hpp"
+#include "common/memory_buffer.hpp"
+
+namespace
+{
+    struct Item
+    {
+        uint32_t m_value;
+    };
+}
+
+TEST_CASE( "Config")
+{
+    using namespace kernel::internal;
+
+    SECTION ( "Options are overridden by user header and build system.")
+    {
+        REQUIRE( 0U == event_group::max_number);
+        REQUIRE( 0U == semaphore::max_number);
+        REQUIRE( 0U == rw_lock::max_number);
+        REQUIRE( 0U == timer::max_number);
+        REQUIRE( false == timer::callback_enable);
+        REQUIRE( 0U == queue::max_number);
+        REQUIRE( 0U == ring_buffer::max_number);
+        REQUIRE( 0U == mpsc_queue::max_number);
+        REQUIRE( 0U == priority_queue::max_number);
+        REQUIRE( 0U == stream_buffer::max_number);
+        REQUIRE( 0U == queue_set::max_number);
+        REQUIRE( 4U == registry::max_number);
+
+        REQUIRE( 4U == task::max_number);
+    }
+
+    SECTION ( "Options which are not overridden keep default values.")
+    {
+        REQUIRE( 8U == event::max_number);
+        REQUIRE( 8U == scheduler::wait::max_input_signals);
+        REQUIRE( 10U == system_timer::context_switch_interval_ms);
+    }
+
+    SECTION ( "Disabled object type has empty storage.")
+    {
+        common::MemoryBuffer< Item, timer::max_number> buffer;
+        typedef common::MemoryBuffer< Item, timer::max_number>::Id MemoryId;
+
+        REQUIRE( sizeof( buffer) < sizeof( common::MemoryBuffer< Item, 1U>));
+
+        MemoryId id;
+
+        REQUIRE( false == buffer.allocate( id));
+    }
+}
@@ -0,0 +1,88 @@
+#include "catch.hpp"
+
+#include "critical_section/critical_section.hpp"
+
+#include <chrono>
+#include <iostream>
+#include <iomanip>
+#include <thread>
+#include <vector>
+
+// Host benchmarks of software critical section lock word. They are hidden from default test run and must
+// be selected explicitly, ie. 'tests.exe [benchmark]'.
+// Note: Host numbers are only useful to compare implementations with each other.
+//       For real cycle counts see examples/critical_section_benchmark.
+//       Blocking on kernel event is replaced with yield of host thread.
+
+namespace
+{
+    constexpr size_t number_of_rounds{ 1'000'000U};
+
+    // Return average enter + leave time in nanoseconds, when a_threads threads share one critical section.
+    double measureEnterLeave( size_t a_threads)
+    {
+        using namespace kernel::internal;
+
+        critical_section::Context context;
+        critical_section::init( context, 100U);
+
+        volatile uint32_t shared_counter{ 0U};
+
+        auto worker = [ &context, &shared_counter]( uint32_t a_owner)
+        {
+            for ( size_t round = 0U; round < number_of_rounds; ++round)
+            {
+                if ( false == critical_section::tryEnter( context, a_owner) &&
+                     false == critical_section::spinEnter( context, a_owner))
+                {
+                    critical_section::addWaiter( context);
+
+                    while ( false == critical_section::tryEnter( context, a_owner))
+                    {
+                        std::this_thread::yield();
+                    }
+
+                    critical_section::removeWaiter( context);
+                }
+
+                shared_counter = shared_counter + 1U;
+
+                ( void) critical_section::leave( context);
+            }
+        };
+
+        const auto start = std::chrono::steady_clock::now();
+
+        std::vector< std::thread> threads;
+
+        for ( size_t i = 0U; i < a_threads; ++i)
+        {
+            threads.emplace_back( worker, static_cast< uint32_t>( i));
+        }
+
+        for ( auto & thread : threads)
+        {
+            thread.join();
+        }
+
+        const auto stop = std::chrono::steady_clock::now();
+        const double elapsed_ns = std::chrono::duration< double, std::nano>( stop - start).count();
+
+        // Critical section must protect shared data.
+        REQUIRE( number_of_rounds * a_threads == shared_counter);
+
+        return elapsed_ns / static_cast< double>( number_of_rounds * a_threads);
+    }
+}
+
+TEST_CASE( "Critical section enter and leave cost", "[.][benchmark]")
+{
+    std::cout << "\ncritical_section enter + leave, " << number_of_rounds << " rounds per thread:\n";
+
+    for ( size_t threads : { 1U, 2U, 4U})
+    {
+        std::cout
+            << std::setw( 3) << threads << " thread(s) | "
+            << std::setw( 10) << std::fixed << std::setprecision( 2) << measureEnterLeave( threads) << " ns\n";
+    }
+}
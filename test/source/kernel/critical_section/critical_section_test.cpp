@@ -0,0 +1,94 @@
+#include "catch.hpp"
+
+#include "critical_section/critical_section.hpp"
+
+TEST_CASE( "CriticalSection")
+{
+    using namespace kernel::internal;
+
+    critical_section::Context context;
+
+    critical_section::init( context, 100U);
+
+    constexpr uint32_t first_owner{ 0U};
+    constexpr uint32_t second_owner{ 1U};
+
+    SECTION ( "Enter and leave without waiters.")
+    {
+        REQUIRE( true == critical_section::tryEnter( context, first_owner));
+        REQUIRE( true == critical_section::isOwner( context, first_owner));
+        REQUIRE( false == critical_section::tryEnter( context, second_owner));
+
+        // Nobody has to be woken up.
+        REQUIRE( false == critical_section::leave( context));
+        REQUIRE( false == critical_section::isOwner( context, first_owner));
+
+        REQUIRE( true == critical_section::tryEnter( context, second_owner));
+        REQUIRE( false == critical_section::leave( context));
+    }
+
+    SECTION ( "Owner enters recursively.")
+    {
+        REQUIRE( true == critical_section::tryEnter( context, first_owner));
+        REQUIRE( true == critical_section::tryEnter( context, first_owner));
+        REQUIRE( 2U == context.m_lockCount);
+
+        critical_section::addWaiter( context);
+
+        // Nested leave keeps critical section taken, even if there is a waiter.
+        REQUIRE( false == critical_section::leave( context));
+        REQUIRE( true == critical_section::isOwner( context, first_owner));
+        REQUIRE( false == critical_section::tryEnter( context, second_owner));
+
+        REQUIRE( true == critical_section::leave( context));
+        REQUIRE( false == critical_section::isOwner( context, first_owner));
+    }
+
+    SECTION ( "Released critical section is handed over to a waiter.")
+    {
+        REQUIRE( true == critical_section::tryEnter( context, first_owner));
+
+        critical_section::addWaiter( context);
+
+        REQUIRE( true == critical_section::leave( context));
+
+        // Kernel takes critical section on behalf of waiter.
+        REQUIRE( true == critical_section::tryLock( context, second_owner));
+        REQUIRE( true == critical_section::isOwner( context, second_owner));
+        REQUIRE( 1U == context.m_lockCount);
+
+        // Critical section can't be handed over, when it was taken in the meantime.
+        REQUIRE( false == critical_section::tryLock( context, first_owner));
+
+        critical_section::removeWaiter( context);
+
+        REQUIRE( false == critical_section::leave( context));
+    }
+
+    SECTION ( "Spin limit adapts to hold times.")
+    {
+        REQUIRE( 100U == context.m_spinLock);
+
+        // Owner never releases critical section, so spin limit shrinks to its minimum.
+        REQUIRE( true == critical_section::tryEnter( context, first_owner));
+
+        for ( uint32_t i = 0U; i < 100U; ++i)
+        {
+            REQUIRE( false == critical_section::spinEnter( context, second_owner));
+        }
+
+        REQUIRE( critical_section::min_spin == context.m_spinLock);
+
+        // Free critical section is taken at first spin and limit stays at its minimum.
+        REQUIRE( false == critical_section::leave( context));
+        REQUIRE( true == critical_section::spinEnter( context, second_owner));
+        REQUIRE( critical_section::min_spin == context.m_spinLock);
+        REQUIRE( false == critical_section::leave( context));
+
+        // Limit never exceeds maximum given in init.
+        critical_section::init( context, 2U);
+
+        REQUIRE( critical_section::min_spin == context.m_spinLockMax);
+        REQUIRE( critical_section::min_spin == context.m_spinLock);
+    }
+}
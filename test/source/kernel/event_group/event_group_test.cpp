@@ -0,0 +1,101 @@
+#include "catch.hpp"
+
+#include "event_group/event_group.hpp"
+
+TEST_CASE( "EventGroup")
+{
+    using namespace kernel::internal;
+
+    event_group::Context context;
+
+    SECTION ( "Set, clear and get flags.")
+    {
+        event_group::Id id;
+
+        REQUIRE( true == event_group::create( context, id));
+        REQUIRE( 0U == event_group::get( context, id));
+
+        REQUIRE( 0x0000'0005U == event_group::set( context, id, 0x0000'0005U));
+        REQUIRE( 0x8000'0005U == event_group::set( context, id, 0x8000'0000U));
+
+        REQUIRE( 0x8000'0005U == event_group::clear( context, id, 0x0000'0001U));
+        REQUIRE( 0x8000'0004U == event_group::get( context, id));
+
+        event_group::destroy( context, id);
+
+        // Recreated group starts with all flags cleared.
+        REQUIRE( true == event_group::create( context, id));
+        REQUIRE( 0U == event_group::get( context, id));
+    }
+
+    SECTION ( "Wait for any and all flags of mask.")
+    {
+        event_group::Id id;
+        uint32_t flags = 0U;
+
+        REQUIRE( true == event_group::create( context, id));
+
+        constexpr bool wait_for_all{ true};
+        constexpr bool wait_for_any{ false};
+        constexpr bool clear_on_exit{ true};
+        constexpr bool keep_on_exit{ false};
+
+        REQUIRE( false == event_group::testAndClear( context, id, 0x0000'0003U, wait_for_any, clear_on_exit, flags));
+        REQUIRE( 0U == flags);
+
+        event_group::set( context, id, 0x0000'0102U);
+
+        REQUIRE( false == event_group::testAndClear( context, id, 0x0000'0003U, wait_for_all, clear_on_exit, flags));
+        REQUIRE( 0x0000'0102U == flags);
+
+        // Flags are returned as they were before clear.
+        REQUIRE( true == event_group::testAndClear( context, id, 0x0000'0003U, wait_for_any, keep_on_exit, flags));
+        REQUIRE( 0x0000'0102U == flags);
+        REQUIRE( true == event_group::testAndClear( context, id, 0x0000'0003U, wait_for_any, clear_on_exit, flags));
+        REQUIRE( 0x0000'0102U == flags);
+
+        // Only masked flags are cleared.
+        REQUIRE( 0x0000'0100U == event_group::get( context, id));
+
+        event_group::set( context, id, 0x0000'0003U);
+
+        REQUIRE( true == event_group::testAndClear( context, id, 0x0000'0003U, wait_for_all, clear_on_exit, flags));
+        REQUIRE( 0x0000'0103U == flags);
+        REQUIRE( 0x0000'0100U == event_group::get( context, id));
+    }
+
+    SECTION ( "Registered waiter is signaled when its mask is matched.")
+    {
+        event_group::Id first_id;
+        event_group::Id second_id;
+
+        REQUIRE( true == event_group::create( context, first_id));
+        REQUIRE( true == event_group::create( context, second_id));
+
+        constexpr uint32_t first_waiter{ 1U};
+        constexpr uint32_t second_waiter{ 2U};
+
+        event_group::registerWaiter( context, first_waiter, first_id, 0x0000'0003U, true);
+        event_group::registerWaiter( context, second_waiter, second_id, 0x0000'0003U, false);
+
+        REQUIRE( false == event_group::isWaiterSignaled( context, first_waiter));
+        REQUIRE( false == event_group::isWaiterSignaled( context, second_waiter));
+
+        event_group::set( context, first_id, 0x0000'0001U);
+
+        REQUIRE( false == event_group::isWaiterSignaled( context, first_waiter));
+        REQUIRE( false == event_group::isWaiterSignaled( context, second_waiter));
+
+        event_group::set( context, first_id, 0x0000'0002U);
+        event_group::set( context, second_id, 0x0000'0002U);
+
+        REQUIRE( true == event_group::isWaiterSignaled( context, first_waiter));
+        REQUIRE( true == event_group::isWaiterSignaled( context, second_waiter));
+
+        // Waiter, which is not registered, is never signaled.
+        event_group::unregisterWaiter( context, first_waiter);
+
+        REQUIRE( false == event_group::isWaiterSignaled( context, first_waiter));
+        REQUIRE( false == event_group::isWaiterSignaled( context, 0U));
+    }
+}
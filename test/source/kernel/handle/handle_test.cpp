@@ -6,6 +6,7 @@
 #include "event.hpp"
 #include "timer.hpp"
 #include "queue/queue.hpp"
+#include "ring_buffer/ring_buffer.hpp"
 
 TEST_CASE( "Handle")
 {
@@ -49,13 +50,11 @@ TEST_CASE( "Handle")
         using namespace kernel::internal;
         SECTION ( "Handle point to event.")
         {
-            std::unique_ptr< timer::Context> timer_context( new timer::Context);
-            std::unique_ptr< event::Context> event_context( new event::Context);
-            std::unique_ptr< queue::Context> queue_context( new queue::Context);
+            std::unique_ptr< handle::Context> object_context( new handle::Context);
 
             // Prepare event object and handle.
             event::Id new_index;
-            bool event_created = event::create( *event_context, new_index, false, nullptr);
+            bool event_created = event::create( object_context->m_events, new_index, false, nullptr);
 
             REQUIRE( true == event_created);
 
@@ -66,9 +65,7 @@ TEST_CASE( "Handle")
             // Expected: event is in Reset state, so check result should be false.
             bool condition_check_result = false;
             bool valid_handle = handle::testCondition(
-                *timer_context,
-                *event_context,
-                *queue_context,
+                *object_context,
                 new_handle,
                 condition_check_result
             );
@@ -77,14 +74,12 @@ TEST_CASE( "Handle")
             REQUIRE( false == condition_check_result);
 
             // Set event.
-            event::set( *event_context, new_index);
+            event::set( object_context->m_events, new_index);
 
             // Test the handle.
             // Expected: event is in SET state, so check result should be true.
             valid_handle = handle::testCondition(
-                *timer_context,
-                *event_context,
-                *queue_context,
+                *object_context,
                 new_handle,
                 condition_check_result
             );
@@ -95,20 +90,18 @@ TEST_CASE( "Handle")
 
         SECTION ( "Handle point to timer.")
         {
-            std::unique_ptr< timer::Context> timer_context( new timer::Context);
-            std::unique_ptr< event::Context> event_context( new event::Context);
-            std::unique_ptr< queue::Context> queue_context( new queue::Context);
+            std::unique_ptr< handle::Context> object_context( new handle::Context);
 
             // Prepare event object and handle.
             timer::Id new_index;
             kernel::TimeMs start = 0U;
             kernel::TimeMs interval = 100U;
-            bool timer_created = timer::create( *timer_context, new_index, start, interval);
+            bool timer_created = timer::create( object_context->m_timers, new_index, start, interval);
 
             REQUIRE( true == timer_created);
 
             // Start timer.
-            kernel::internal::timer::start( *timer_context, new_index);
+            kernel::internal::timer::start( object_context->m_timers, new_index);
 
             // Create handle.
             kernel::Handle new_handle = handle::create( handle::ObjectType::Timer, new_index);
@@ -117,9 +110,7 @@ TEST_CASE( "Handle")
             // Expected: Timer is in Started state and condition should be false.
             bool condition_check_result = false;
             bool valid_handle = handle::testCondition(
-                *timer_context,
-                *event_context,
-                *queue_context,
+                *object_context,
                 new_handle,
                 condition_check_result
             );
@@ -129,14 +120,12 @@ TEST_CASE( "Handle")
 
             // Finish timer.
             kernel::TimeMs current_time = start + interval + 1U;
-            timer::tick( *timer_context, current_time);
+            timer::tick( object_context->m_timers, current_time);
 
             // Test the handle.
             // Expected: Timer is in Finished state and condition should be true.
             valid_handle = handle::testCondition(
-                *timer_context,
-                *event_context,
-                *queue_context,
+                *object_context,
                 new_handle,
                 condition_check_result
             );
@@ -146,9 +135,7 @@ TEST_CASE( "Handle")
         }
         SECTION ( "Handle point to queue.")
         {
-            std::unique_ptr< timer::Context> timer_context( new timer::Context);
-            std::unique_ptr< event::Context> event_context( new event::Context);
-            std::unique_ptr< queue::Context> queue_context( new queue::Context);
+            std::unique_ptr< handle::Context> object_context( new handle::Context);
 
             // Prepare event object and handle.
             queue::Id        new_index;
@@ -160,7 +147,7 @@ TEST_CASE( "Handle")
             size_t           data_type_size = sizeof(buffer[0]);
 
             bool queue_created = queue::create(
-                *queue_context,
+                object_context->m_queues,
                 new_index,
                 data_max_size,
                 data_type_size,
@@ -177,9 +164,7 @@ TEST_CASE( "Handle")
             // Expected: Queue is empty and test condition should return false.
             bool condition_check_result = false;
             bool valid_handle = handle::testCondition(
-                *timer_context,
-                *event_context,
-                *queue_context,
+                *object_context,
                 new_handle,
                 condition_check_result
             );
@@ -189,16 +174,14 @@ TEST_CASE( "Handle")
 
             // Add items to the queue.
             int data = 0x1234'ABCD;
-            bool data_sent = queue::send( *queue_context, new_index, &data);
+            bool data_sent = queue::send( object_context->m_queues, new_index, &data);
 
             REQUIRE( true == data_sent);
 
             // Test the handle.
             // Expected: Queue is not empty and test condition should return true.
             valid_handle = handle::testCondition(
-                *timer_context,
-                *event_context,
-                *queue_context,
+                *object_context,
                 new_handle,
                 condition_check_result
             );
@@ -207,20 +190,341 @@ TEST_CASE( "Handle")
             REQUIRE( true == condition_check_result);
         }
 
+        SECTION ( "Handle point to queue receiver condition.")
+        {
+            std::unique_ptr< handle::Context> object_context( new handle::Context);
+
+            queue::Id        new_index;
+
+            constexpr size_t max_elements = 2U;
+            int              buffer[ max_elements]{};
+
+            size_t           data_max_size = max_elements;
+            size_t           data_type_size = sizeof( buffer[ 0]);
+
+            bool queue_created = queue::create(
+                object_context->m_queues,
+                new_index,
+                data_max_size,
+                data_type_size,
+                buffer,
+                nullptr
+            );
+
+            REQUIRE( true == queue_created);
+
+            kernel::Handle queue_handle = handle::create( handle::ObjectType::Queue, new_index);
+            kernel::Handle receiver_handle = handle::create( handle::ObjectType::QueueReceiver, new_index);
+
+            // Register receiver and hand off item to it.
+            const kernel::Handle receiver{ 5U};
+            int received_data = 0;
+
+            REQUIRE( false == queue::receiveOrRegister( object_context->m_queues, new_index, &received_data, receiver));
+
+            int data = 0x1234'ABCD;
+
+            REQUIRE( true == queue::send( object_context->m_queues, new_index, &data));
+
+            // Expected: Only registered receiver condition is signaled, queue itself is empty.
+            bool condition_check_result = true;
+            bool valid_handle = handle::testCondition(
+                *object_context,
+                queue_handle,
+                condition_check_result
+            );
+
+            REQUIRE( true == valid_handle);
+            REQUIRE( false == condition_check_result);
+
+            condition_check_result = false;
+            valid_handle = handle::testCondition(
+                *object_context,
+                receiver_handle,
+                condition_check_result
+            );
+
+            REQUIRE( true == valid_handle);
+            REQUIRE( true == condition_check_result);
+
+            // Expected: After handoff is picked up, receiver condition is not signaled.
+            REQUIRE( true == queue::unregisterReceiver( object_context->m_queues, new_index, receiver));
+
+            valid_handle = handle::testCondition(
+                *object_context,
+                receiver_handle,
+                condition_check_result
+            );
+
+            REQUIRE( true == valid_handle);
+            REQUIRE( false == condition_check_result);
+        }
+
+        SECTION ( "Handle point to queue not full condition.")
+        {
+            std::unique_ptr< handle::Context> object_context( new handle::Context);
+
+            queue::Id        new_index;
+
+            constexpr size_t max_elements = 2U;
+            int              buffer[ max_elements]{};
+
+            size_t           data_max_size = max_elements;
+            size_t           data_type_size = sizeof( buffer[ 0]);
+
+            bool queue_created = queue::create(
+                object_context->m_queues,
+                new_index,
+                data_max_size,
+                data_type_size,
+                buffer,
+                nullptr
+            );
+
+            REQUIRE( true == queue_created);
+
+            kernel::Handle new_handle = handle::create( handle::ObjectType::QueueNotFull, new_index);
+
+            // Expected: Queue is empty, so it is not full and test condition should return true.
+            bool condition_check_result = false;
+            bool valid_handle = handle::testCondition(
+                *object_context,
+                new_handle,
+                condition_check_result
+            );
+
+            REQUIRE( true == valid_handle);
+            REQUIRE( true == condition_check_result);
+
+            // Fill up the queue.
+            int data = 0x1234'ABCD;
+
+            REQUIRE( true == queue::send( object_context->m_queues, new_index, &data));
+            REQUIRE( true == queue::send( object_context->m_queues, new_index, &data));
+
+            // Expected: Queue is full and test condition should return false.
+            valid_handle = handle::testCondition(
+                *object_context,
+                new_handle,
+                condition_check_result
+            );
+
+            REQUIRE( true == valid_handle);
+            REQUIRE( false == condition_check_result);
+        }
+
+        SECTION ( "Handle point to ring buffer.")
+        {
+            std::unique_ptr< handle::Context> object_context( new handle::Context);
+
+            ring_buffer::Id  new_index;
+
+            constexpr size_t max_elements = 4U;
+            int              buffer[ max_elements]{};
+
+            bool ring_buffer_created = ring_buffer::create(
+                object_context->m_ring_buffers,
+                new_index,
+                max_elements,
+                sizeof( buffer[ 0]),
+                buffer
+            );
+
+            REQUIRE( true == ring_buffer_created);
+
+            kernel::Handle new_handle = handle::create( handle::ObjectType::RingBuffer, new_index);
+
+            // Expected: Ring buffer is empty and test condition should return false.
+            bool condition_check_result = false;
+            bool valid_handle = handle::testCondition(
+                *object_context,
+                new_handle,
+                condition_check_result
+            );
+
+            REQUIRE( true == valid_handle);
+            REQUIRE( false == condition_check_result);
+
+            int data = 0x1234'ABCD;
+            bool data_sent = ring_buffer::send( object_context->m_ring_buffers, new_index, &data);
+
+            REQUIRE( true == data_sent);
+
+            // Expected: Ring buffer is not empty and test condition should return true.
+            valid_handle = handle::testCondition(
+                *object_context,
+                new_handle,
+                condition_check_result
+            );
+
+            REQUIRE( true == valid_handle);
+            REQUIRE( true == condition_check_result);
+        }
+
+        SECTION ( "Handle point to priority queue.")
+        {
+            std::unique_ptr< handle::Context> object_context( new handle::Context);
+
+            priority_queue::Id new_index;
+
+            constexpr size_t max_elements = 2U;
+            kernel::priority_queue::Buffer< int, max_elements> buffer;
+
+            bool queue_created = priority_queue::create(
+                object_context->m_priority_queues,
+                new_index,
+                max_elements,
+                sizeof( int),
+                &buffer.m_data,
+                buffer.m_entries
+            );
+
+            REQUIRE( true == queue_created);
+
+            kernel::Handle new_handle = handle::create( handle::ObjectType::PriorityQueue, new_index);
+
+            // Expected: Priority queue is empty and test condition should return false.
+            bool condition_check_result = false;
+            bool valid_handle = handle::testCondition(
+                *object_context,
+                new_handle,
+                condition_check_result
+            );
+
+            REQUIRE( true == valid_handle);
+            REQUIRE( false == condition_check_result);
+
+            int data = 0x1234'ABCD;
+            bool data_sent = priority_queue::sendToFront( object_context->m_priority_queues, new_index, &data);
+
+            REQUIRE( true == data_sent);
+
+            // Expected: Priority queue is not empty and test condition should return true.
+            valid_handle = handle::testCondition(
+                *object_context,
+                new_handle,
+                condition_check_result
+            );
+
+            REQUIRE( true == valid_handle);
+            REQUIRE( true == condition_check_result);
+        }
+
+        SECTION ( "Handle point to stream and message buffer.")
+        {
+            std::unique_ptr< handle::Context> object_context( new handle::Context);
+
+            stream_buffer::Id stream_index;
+            stream_buffer::Id message_index;
+
+            constexpr size_t max_size = 8U;
+            kernel::stream_buffer::Buffer< max_size> stream_memory;
+            kernel::message_buffer::Buffer< max_size> message_memory;
+
+            REQUIRE( true == stream_buffer::create( object_context->m_stream_buffers, stream_index, max_size, &stream_memory.m_data, 2U, false));
+            REQUIRE( true == stream_buffer::create( object_context->m_stream_buffers, message_index, max_size, &message_memory.m_data, 1U, true));
+
+            kernel::Handle stream_handle = handle::create( handle::ObjectType::StreamBuffer, stream_index);
+            kernel::Handle message_handle = handle::create( handle::ObjectType::MessageBuffer, message_index);
+
+            // Expected: Both buffers are empty and test condition should return false.
+            bool condition_check_result = true;
+
+            REQUIRE( true == handle::testCondition( *object_context, stream_handle, condition_check_result));
+            REQUIRE( false == condition_check_result);
+
+            condition_check_result = true;
+
+            REQUIRE( true == handle::testCondition( *object_context, message_handle, condition_check_result));
+            REQUIRE( false == condition_check_result);
+
+            // Expected: Stream buffer is signaled only at its trigger level.
+            REQUIRE( 1U == stream_buffer::send( object_context->m_stream_buffers, stream_index, "a", 1U));
+            REQUIRE( true == handle::testCondition( *object_context, stream_handle, condition_check_result));
+            REQUIRE( false == condition_check_result);
+
+            REQUIRE( 1U == stream_buffer::send( object_context->m_stream_buffers, stream_index, "b", 1U));
+            REQUIRE( true == handle::testCondition( *object_context, stream_handle, condition_check_result));
+            REQUIRE( true == condition_check_result);
+
+            // Expected: Message buffer is signaled by the first message.
+            REQUIRE( true == stream_buffer::sendMessage( object_context->m_stream_buffers, message_index, "m", 1U));
+            REQUIRE( true == handle::testCondition( *object_context, message_handle, condition_check_result));
+            REQUIRE( true == condition_check_result);
+        }
+
+        SECTION ( "Handle point to stream buffer not full condition.")
+        {
+            std::unique_ptr< handle::Context> object_context( new handle::Context);
+
+            stream_buffer::Id stream_index;
+
+            constexpr size_t max_size = 4U;
+            kernel::stream_buffer::Buffer< max_size> stream_memory;
+
+            REQUIRE( true == stream_buffer::create( object_context->m_stream_buffers, stream_index, max_size, &stream_memory.m_data, 1U, false));
+
+            kernel::Handle not_full_handle = handle::create( handle::ObjectType::StreamBufferNotFull, stream_index);
+
+            // Expected: Buffer is empty, so it is not full and test condition should return true.
+            bool condition_check_result = false;
+
+            REQUIRE( true == handle::testCondition( *object_context, not_full_handle, condition_check_result));
+            REQUIRE( true == condition_check_result);
+
+            // Expected: Buffer is full and test condition should return false.
+            REQUIRE( max_size == stream_buffer::send( object_context->m_stream_buffers, stream_index, "abcd", max_size));
+            REQUIRE( true == handle::testCondition( *object_context, not_full_handle, condition_check_result));
+            REQUIRE( false == condition_check_result);
+        }
+
+        SECTION ( "Handle point to queue set.")
+        {
+            std::unique_ptr< handle::Context> object_context( new handle::Context);
+
+            queue_set::Id new_index;
+            event::Id event_index;
+
+            REQUIRE( true == queue_set::create( object_context->m_queue_sets, new_index));
+            REQUIRE( true == event::create( object_context->m_events, event_index, false, nullptr));
+
+            kernel::Handle new_handle = handle::create( handle::ObjectType::QueueSet, new_index);
+            kernel::Handle member_handle = handle::create( handle::ObjectType::Event, event_index);
+
+            REQUIRE( true == queue_set::addMember( object_context->m_queue_sets, new_index, 0U, member_handle));
+
+            // Expected: No member is ready and test condition should return false.
+            bool condition_check_result = true;
+
+            REQUIRE( true == handle::testCondition( *object_context, new_handle, condition_check_result));
+            REQUIRE( false == condition_check_result);
+
+            event::set( object_context->m_events, event_index);
+            queue_set::notify( object_context->m_queue_sets, 0U, nullptr);
+
+            // Expected: Member is ready and test condition should return true.
+            REQUIRE( true == handle::testCondition( *object_context, new_handle, condition_check_result));
+            REQUIRE( true == condition_check_result);
+
+            // Expected: Member was reset without select, so it is dropped and test condition
+            // should return false.
+            event::reset( object_context->m_events, event_index);
+
+            REQUIRE( true == handle::testCondition( *object_context, new_handle, condition_check_result));
+            REQUIRE( false == condition_check_result);
+            REQUIRE( true == queue_set::isEmpty( object_context->m_queue_sets, new_index));
+        }
+
         SECTION ( "Handle point to unsupported system object.")
         {
-            std::unique_ptr< timer::Context> timer_context( new timer::Context);
-            std::unique_ptr< event::Context> event_context( new event::Context);
-            std::unique_ptr< queue::Context> queue_context( new queue::Context);
+            std::unique_ptr< handle::Context> object_context( new handle::Context);
 
             kernel::Handle invalid_handle = ( kernel::Handle) 0xaf23123U;
 
             // Invalid handle should result in funtion returning false.
             bool condition_check_result = false;
             bool valid_handle = handle::testCondition(
-                *timer_context,
-                *event_context,
-                *queue_context,
+                *object_context,
                 invalid_handle,
                 condition_check_result
             );
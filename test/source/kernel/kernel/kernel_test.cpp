@@ -0,0 +1,106 @@
+#include "catch.hpp"
+
+#include <kernel.hpp>
+#include <hardware/hardware.hpp>
+
+#include "hardware_stubs.hpp"
+
+// This test unit runs the whole kernel on hardware stubs. Task routines are never called:
+// test acts as running task or interrupt routine and drives kernel entries itself.
+// Kernel context is global, so it is initialized and started only once.
+namespace
+{
+    kernel::Handle worker;
+    kernel::Handle worker_event;
+
+    void workerRoutine( void * a_parameter)
+    {
+    }
+
+    // Start kernel with worker task, which runs first.
+    void startKernel()
+    {
+        static bool is_started = false;
+
+        if ( true == is_started)
+        {
+            return;
+        }
+
+        kernel::init();
+
+        REQUIRE( true == kernel::task::create( workerRoutine, kernel::task::Priority::High, &worker));
+        REQUIRE( true == kernel::event::create( worker_event));
+
+        kernel::start();
+
+        REQUIRE( worker == kernel::task::getCurrent());
+
+        is_started = true;
+    }
+}
+
+TEST_CASE( "Kernel")
+{
+    using namespace kernel::internal;
+
+    startKernel();
+
+    SECTION ( "Reschedule pended by interrupt routine does not advance time and runs woken task.")
+    {
+        // Worker waits, so Idle task runs.
+        ( void) kernel::sync::waitForSingleObject( worker_event, true);
+
+        REQUIRE( worker != kernel::task::getCurrent());
+
+        const kernel::TimeMs time = kernel::getTime();
+
+        hardware::stubs::is_handler_mode = true;
+        hardware::stubs::is_reschedule_pended = false;
+
+        kernel::event::set( worker_event);
+
+        REQUIRE( true == hardware::stubs::is_reschedule_pended);
+        REQUIRE( true == tick( false));
+
+        hardware::stubs::is_handler_mode = false;
+
+        REQUIRE( time == kernel::getTime());
+        REQUIRE( worker == kernel::task::getCurrent());
+
+        // Only system tick counts time.
+        ( void) tick( true);
+
+        REQUIRE( ( time + 1U) == kernel::getTime());
+    }
+
+    SECTION ( "Typed queue changed by interrupt routine pends reschedule.")
+    {
+        kernel::static_queue::Typed< uint32_t, 4U> typed_queue;
+        uint32_t received_data{ 0U};
+
+        REQUIRE( true == kernel::static_queue::create( typed_queue));
+
+        hardware::stubs::is_handler_mode = true;
+        hardware::stubs::is_reschedule_pended = false;
+
+        REQUIRE( true == kernel::static_queue::send( typed_queue, 0x1234U));
+        REQUIRE( true == hardware::stubs::is_reschedule_pended);
+
+        hardware::stubs::is_reschedule_pended = false;
+
+        REQUIRE( true == kernel::static_queue::receive( typed_queue, received_data));
+        REQUIRE( true == hardware::stubs::is_reschedule_pended);
+        REQUIRE( 0x1234U == received_data);
+
+        // Nothing changed, so nothing is pended.
+        hardware::stubs::is_reschedule_pended = false;
+
+        REQUIRE( false == kernel::static_queue::receive( typed_queue, received_data));
+        REQUIRE( false == hardware::stubs::is_reschedule_pended);
+
+        hardware::stubs::is_handler_mode = false;
+
+        kernel::static_queue::destroy( typed_queue);
+    }
+}
@@ -0,0 +1,41 @@
+#include "catch.hpp"
+
+#include "lock/lock.hpp"
+
+TEST_CASE( "Lock")
+{
+    using namespace kernel::internal;
+
+    lock::Context context;
+
+    SECTION ( "Nested lock is taken until outermost leave.")
+    {
+        REQUIRE( false == lock::isLocked( context));
+
+        lock::enter( context);
+        lock::enter( context);
+
+        REQUIRE( true == lock::isLocked( context));
+
+        lock::leave( context);
+
+        REQUIRE( true == lock::isLocked( context));
+
+        lock::leave( context);
+
+        REQUIRE( false == lock::isLocked( context));
+    }
+
+    SECTION ( "Tick deferred while lock was taken is taken once.")
+    {
+        REQUIRE( false == lock::takeDeferredTick( context));
+
+        lock::enter( context);
+        lock::deferTick( context);
+        lock::deferTick( context);
+        lock::leave( context);
+
+        REQUIRE( true == lock::takeDeferredTick( context));
+        REQUIRE( false == lock::takeDeferredTick( context));
+    }
+}
@@ -0,0 +1,213 @@
+#include "catch.hpp"
+
+#include "mpsc_queue/mpsc_queue.hpp"
+
+#include <chrono>
+#include <thread>
+#include <vector>
+
+TEST_CASE( "MpscQueue")
+{
+    using namespace kernel::internal;
+
+    SECTION ( "Create new MPSC queue, add and remove items.")
+    {
+        constexpr size_t Max_buffer_size{ 4U};
+        kernel::mpsc_queue::Buffer< int32_t, Max_buffer_size> buffer;
+
+        mpsc_queue::Context context;
+        mpsc_queue::Id id;
+
+        bool mpsc_queue_created = mpsc_queue::create(
+            context,
+            id,
+            Max_buffer_size,
+            sizeof( int32_t),
+            &buffer.m_data,
+            buffer.m_sequences
+        );
+
+        REQUIRE( true == mpsc_queue_created);
+        REQUIRE( true == mpsc_queue::isEmpty( context, id));
+
+        for ( int32_t i = 0; i < static_cast< int32_t>( Max_buffer_size); ++i)
+        {
+            REQUIRE( true == mpsc_queue::send( context, id, &i));
+        }
+
+        REQUIRE( Max_buffer_size == mpsc_queue::getSize( context, id));
+
+        // Try adding item to full queue.
+        {
+            int32_t data_to_send = 0x1234'567;
+            REQUIRE( false == mpsc_queue::send( context, id, &data_to_send));
+        }
+
+        for ( int32_t i = 0; i < static_cast< int32_t>( Max_buffer_size); ++i)
+        {
+            int32_t received_data = -1;
+
+            REQUIRE( true == mpsc_queue::receive( context, id, &received_data));
+            REQUIRE( i == received_data);
+        }
+
+        REQUIRE( true == mpsc_queue::isEmpty( context, id));
+
+        // Try removing item from empty queue.
+        {
+            int32_t received_data = -1;
+
+            REQUIRE( false == mpsc_queue::receive( context, id, &received_data));
+            REQUIRE( -1 == received_data);
+        }
+    }
+
+    SECTION ( "Positions wrap around buffer end.")
+    {
+        constexpr size_t Max_buffer_size{ 4U};
+        kernel::mpsc_queue::Buffer< uint8_t, Max_buffer_size> buffer;
+
+        mpsc_queue::Context context;
+        mpsc_queue::Id id;
+
+        REQUIRE( true == mpsc_queue::create( context, id, Max_buffer_size, sizeof( uint8_t), &buffer.m_data, buffer.m_sequences));
+
+        uint8_t next_to_send = 0U;
+        uint8_t next_to_receive = 0U;
+
+        for ( int i = 0; i < 3; ++i)
+        {
+            REQUIRE( true == mpsc_queue::send( context, id, &next_to_send));
+            ++next_to_send;
+        }
+
+        for ( int i = 0; i < 1000; ++i)
+        {
+            REQUIRE( true == mpsc_queue::send( context, id, &next_to_send));
+            ++next_to_send;
+
+            uint8_t received_data{};
+
+            REQUIRE( true == mpsc_queue::receive( context, id, &received_data));
+            REQUIRE( next_to_receive == received_data);
+            ++next_to_receive;
+
+            REQUIRE( 3U == mpsc_queue::getSize( context, id));
+        }
+    }
+
+    SECTION ( "Claimed slot blocks consumer until it is published.")
+    {
+        constexpr size_t Max_buffer_size{ 4U};
+        kernel::mpsc_queue::Buffer< uint32_t, Max_buffer_size> buffer;
+
+        mpsc_queue::Context context;
+        mpsc_queue::Id id;
+
+        REQUIRE( true == mpsc_queue::create( context, id, Max_buffer_size, sizeof( uint32_t), &buffer.m_data, buffer.m_sequences));
+
+        // Preempted producer claimed the first slot, but did not publish it yet.
+        mpsc_queue::MpscQueue & queue = context.m_data.at( static_cast< mpsc_queue::MemoryBufferIndex>( id));
+
+        REQUIRE( true == kernel::internal::hardware::utility::compareAndSwap( queue.m_head, 0U, 1U));
+
+        // Higher priority producer takes the next slot.
+        const uint32_t data_to_send = 2U;
+        REQUIRE( true == mpsc_queue::send( context, id, &data_to_send));
+        REQUIRE( 2U == mpsc_queue::getSize( context, id));
+
+        uint32_t received_data{};
+
+        REQUIRE( true == mpsc_queue::isEmpty( context, id));
+        REQUIRE( false == mpsc_queue::receive( context, id, &received_data));
+
+        // Preempted producer resumes.
+        buffer.m_data[ 0] = 1U;
+        buffer.m_sequences[ 0] = 1U;
+
+        REQUIRE( false == mpsc_queue::isEmpty( context, id));
+
+        REQUIRE( true == mpsc_queue::receive( context, id, &received_data));
+        REQUIRE( 1U == received_data);
+        REQUIRE( true == mpsc_queue::receive( context, id, &received_data));
+        REQUIRE( 2U == received_data);
+    }
+
+    SECTION ( "Many concurrent producers and single consumer.")
+    {
+        constexpr size_t Max_buffer_size{ 16U};
+        constexpr uint32_t Number_of_producers{ 8U};
+        constexpr uint32_t Number_of_items{ 50'000U};
+
+        kernel::mpsc_queue::Buffer< uint32_t, Max_buffer_size> buffer;
+
+        mpsc_queue::Context context;
+        mpsc_queue::Id id;
+
+        REQUIRE( true == mpsc_queue::create( context, id, Max_buffer_size, sizeof( uint32_t), &buffer.m_data, buffer.m_sequences));
+
+        // Producer threads stand for interrupt routines. Unlike interrupt, thread can be preempted
+        // between claiming and publishing of slot. Spinning threads then sleep, instead of yield,
+        // so preempted one can finish on hosts with few cores.
+        auto backOff = []()
+        {
+            std::this_thread::sleep_for( std::chrono::microseconds( 1));
+        };
+
+        // Item holds producer number and counter.
+        std::vector< std::thread> producers;
+
+        for ( uint32_t producer = 0U; producer < Number_of_producers; ++producer)
+        {
+            producers.emplace_back( [ &, producer]()
+            {
+                for ( uint32_t i = 0U; i < Number_of_items; )
+                {
+                    const uint32_t item = ( producer << 24U) | i;
+
+                    if ( true == mpsc_queue::send( context, id, &item))
+                    {
+                        ++i;
+                    }
+                    else
+                    {
+                        backOff();
+                    }
+                }
+            });
+        }
+
+        // Items of each producer are received once and in order.
+        uint32_t expected[ Number_of_producers]{};
+        bool items_in_order = true;
+
+        for ( uint32_t received = 0U; received < ( Number_of_producers * Number_of_items); )
+        {
+            uint32_t received_data{};
+
+            if ( true == mpsc_queue::receive( context, id, &received_data))
+            {
+                const uint32_t producer = received_data >> 24U;
+
+                items_in_order &= ( producer < Number_of_producers);
+                items_in_order &= ( expected[ producer % Number_of_producers] == ( received_data & 0xFF'FFFFU));
+
+                ++expected[ producer % Number_of_producers];
+                ++received;
+            }
+            else
+            {
+                backOff();
+            }
+        }
+
+        for ( std::thread & producer : producers)
+        {
+            producer.join();
+        }
+
+        REQUIRE( true == items_in_order);
+        REQUIRE( true == mpsc_queue::isEmpty( context, id));
+        REQUIRE( 0U == mpsc_queue::getSize( context, id));
+    }
+}
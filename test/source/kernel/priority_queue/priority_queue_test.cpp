@@ -0,0 +1,165 @@
+#include "catch.hpp"
+
+#include "priority_queue/priority_queue.hpp"
+
+#include <random>
+#include <vector>
+#include <algorithm>
+
+TEST_CASE( "PriorityQueue")
+{
+    using namespace kernel::internal;
+
+    SECTION ( "Messages are received by priority, then in FIFO order.")
+    {
+        constexpr size_t Max_buffer_size{ 6U};
+        kernel::priority_queue::Buffer< int32_t, Max_buffer_size> buffer;
+
+        priority_queue::Context context;
+        priority_queue::Id id;
+
+        bool queue_created = priority_queue::create(
+            context,
+            id,
+            Max_buffer_size,
+            sizeof( int32_t),
+            &buffer.m_data,
+            buffer.m_entries
+        );
+
+        REQUIRE( true == queue_created);
+        REQUIRE( true == priority_queue::isEmpty( context, id));
+
+        // Telemetry samples with low priority, control message with high priority.
+        const int32_t messages[]{ 10, 11, 12, 100, 13, 101};
+        const kernel::priority_queue::Priority priorities[]{ 1U, 1U, 1U, 5U, 1U, 5U};
+
+        for ( size_t i = 0U; i < Max_buffer_size; ++i)
+        {
+            REQUIRE( true == priority_queue::send( context, id, &messages[ i], priorities[ i]));
+        }
+
+        REQUIRE( Max_buffer_size == priority_queue::getSize( context, id));
+
+        // Try adding message to full queue.
+        {
+            int32_t data_to_send = 0x1234;
+            REQUIRE( false == priority_queue::send( context, id, &data_to_send, 0xFFU));
+            REQUIRE( false == priority_queue::sendToFront( context, id, &data_to_send));
+        }
+
+        const int32_t expected_messages[]{ 100, 101, 10, 11, 12, 13};
+        const kernel::priority_queue::Priority expected_priorities[]{ 5U, 5U, 1U, 1U, 1U, 1U};
+
+        for ( size_t i = 0U; i < Max_buffer_size; ++i)
+        {
+            int32_t received_data = -1;
+            kernel::priority_queue::Priority received_priority = 0U;
+
+            REQUIRE( true == priority_queue::receive( context, id, &received_data, &received_priority));
+            REQUIRE( expected_messages[ i] == received_data);
+            REQUIRE( expected_priorities[ i] == received_priority);
+        }
+
+        // Try removing message from empty queue.
+        {
+            int32_t received_data = -1;
+
+            REQUIRE( false == priority_queue::receive( context, id, &received_data, nullptr));
+            REQUIRE( -1 == received_data);
+        }
+
+        priority_queue::destroy( context, id);
+    }
+
+    SECTION ( "Messages sent to front overtake all other messages.")
+    {
+        constexpr size_t Max_buffer_size{ 4U};
+        kernel::priority_queue::Buffer< uint8_t, Max_buffer_size> buffer;
+
+        priority_queue::Context context;
+        priority_queue::Id id;
+
+        REQUIRE( true == priority_queue::create( context, id, Max_buffer_size, sizeof( uint8_t), &buffer.m_data, buffer.m_entries));
+
+        const uint8_t highest_priority_message = 1U;
+        const uint8_t first_urgent_message = 2U;
+        const uint8_t second_urgent_message = 3U;
+        const uint8_t lowest_priority_message = 4U;
+
+        REQUIRE( true == priority_queue::send( context, id, &lowest_priority_message, 0U));
+        REQUIRE( true == priority_queue::send( context, id, &highest_priority_message, 0xFFU));
+        REQUIRE( true == priority_queue::sendToFront( context, id, &first_urgent_message));
+        REQUIRE( true == priority_queue::sendToFront( context, id, &second_urgent_message));
+
+        // Urgent messages are received in reverse order.
+        const uint8_t expected_messages[]{ 3U, 2U, 1U, 4U};
+
+        for ( uint8_t expected_message : expected_messages)
+        {
+            uint8_t received_data{};
+
+            REQUIRE( true == priority_queue::receive( context, id, &received_data, nullptr));
+            REQUIRE( expected_message == received_data);
+        }
+    }
+
+    SECTION ( "Random traffic keeps priority and FIFO order, while sequence wraps around.")
+    {
+        constexpr size_t Max_buffer_size{ 16U};
+
+        struct Message
+        {
+            uint32_t m_number;
+            kernel::priority_queue::Priority m_priority;
+        };
+
+        kernel::priority_queue::Buffer< Message, Max_buffer_size> buffer;
+
+        priority_queue::Context context;
+        priority_queue::Id id;
+
+        REQUIRE( true == priority_queue::create( context, id, Max_buffer_size, sizeof( Message), &buffer.m_data, buffer.m_entries));
+
+        // Move sequence close to wrap-around.
+        context.m_data.at( static_cast< priority_queue::MemoryBufferIndex>( id)).m_sequence = 0xFFFF'FF00U;
+
+        std::mt19937 generator( 1234U);
+        std::vector< Message> reference;
+
+        uint32_t next_number = 0U;
+        bool order_kept = true;
+
+        for ( int i = 0; i < 10'000; ++i)
+        {
+            const bool send_message = ( reference.size() < Max_buffer_size) && ( ( 0U == reference.size()) || ( 0U != ( generator() % 2U)));
+
+            if ( true == send_message)
+            {
+                Message message{ next_number++, static_cast< kernel::priority_queue::Priority>( generator() % 4U)};
+
+                REQUIRE( true == priority_queue::send( context, id, &message, message.m_priority));
+                reference.push_back( message);
+            }
+            else
+            {
+                // Expected: the oldest message of the highest priority.
+                auto expected = std::max_element( reference.begin(), reference.end(), []( const Message & a_first, const Message & a_second)
+                {
+                    return ( a_first.m_priority < a_second.m_priority) ||
+                        ( ( a_first.m_priority == a_second.m_priority) && ( a_first.m_number > a_second.m_number));
+                });
+
+                Message received{};
+
+                REQUIRE( true == priority_queue::receive( context, id, &received, nullptr));
+
+                order_kept &= ( expected->m_number == received.m_number);
+                reference.erase( expected);
+            }
+        }
+
+        REQUIRE( true == order_kept);
+        REQUIRE( reference.size() == priority_queue::getSize( context, id));
+    }
+}
@@ -0,0 +1,177 @@
+#include "catch.hpp"
+
+#include "queue/queue.hpp"
+
+#include <chrono>
+#include <iostream>
+#include <iomanip>
+#include <memory>
+
+// Host benchmarks of static queue and Typed static queue. They are hidden from default test run and must be
+// selected explicitly, ie. 'tests.exe [benchmark]'.
+// Note: Host numbers are only useful to compare implementations with each other.
+//       For real cycle counts see examples/queue_benchmark.
+
+namespace
+{
+    constexpr size_t queue_length{ 16U};
+    constexpr size_t number_of_rounds{ 200'000U};
+
+    template< size_t Size>
+    struct Element
+    {
+        alignas( Size % 4U == 0U ? 4U : 1U) uint8_t m_data[ Size];
+    };
+
+    // Return number of elements moved through the queue per microsecond.
+    template< size_t Size>
+    double measureQueueThroughput()
+    {
+        using namespace kernel::internal;
+
+        kernel::static_queue::Buffer< Element< Size>, queue_length> buffer;
+
+        std::unique_ptr< queue::Context> queue_context( new queue::Context);
+        queue::Id queue_id;
+
+        size_t max_elements{ queue_length};
+        size_t type_size{ sizeof( Element< Size>)};
+
+        bool queue_created = queue::create( *queue_context, queue_id, max_elements, type_size, &buffer.m_data, nullptr);
+
+        REQUIRE( true == queue_created);
+
+        Element< Size> input{};
+        Element< Size> output{};
+
+        const auto start = std::chrono::steady_clock::now();
+
+        for ( size_t round = 0U; round < number_of_rounds; ++round)
+        {
+            for ( size_t i = 0U; i < queue_length; ++i)
+            {
+                ( void) queue::send( *queue_context, queue_id, &input);
+            }
+
+            for ( size_t i = 0U; i < queue_length; ++i)
+            {
+                ( void) queue::receive( *queue_context, queue_id, &output);
+            }
+        }
+
+        const auto stop = std::chrono::steady_clock::now();
+        const double elapsed_us = std::chrono::duration< double, std::micro>( stop - start).count();
+
+        queue::destroy( *queue_context, queue_id);
+
+        return static_cast< double>( number_of_rounds * queue_length) / elapsed_us;
+    }
+
+    // Return number of elements moved through the Typed queue per microsecond.
+    template< size_t Size>
+    double measureTypedQueueThroughput()
+    {
+        using namespace kernel::internal;
+
+        std::unique_ptr< kernel::static_queue::Typed< Element< Size>, queue_length>> typed_queue(
+            new kernel::static_queue::Typed< Element< Size>, queue_length>
+        );
+
+        std::unique_ptr< queue::Context> queue_context( new queue::Context);
+        queue::Id queue_id;
+
+        bool queue_created = queue::createTyped( *queue_context, queue_id, queue_length, typed_queue->m_indexes, nullptr);
+
+        REQUIRE( true == queue_created);
+
+        Element< Size> input{};
+        Element< Size> output{};
+
+        const auto start = std::chrono::steady_clock::now();
+
+        for ( size_t round = 0U; round < number_of_rounds; ++round)
+        {
+            for ( size_t i = 0U; i < queue_length; ++i)
+            {
+                ( void) kernel::static_queue::send( *typed_queue, input);
+            }
+
+            for ( size_t i = 0U; i < queue_length; ++i)
+            {
+                ( void) kernel::static_queue::receive( *typed_queue, output);
+            }
+        }
+
+        const auto stop = std::chrono::steady_clock::now();
+        const double elapsed_us = std::chrono::duration< double, std::micro>( stop - start).count();
+
+        queue::destroy( *queue_context, queue_id);
+
+        return static_cast< double>( number_of_rounds * queue_length) / elapsed_us;
+    }
+
+    // Return number of elements moved through the queue per microsecond, when whole
+    // queue length is sent and received with single batch call.
+    template< size_t Size>
+    double measureBatchQueueThroughput()
+    {
+        using namespace kernel::internal;
+
+        kernel::static_queue::Buffer< Element< Size>, queue_length> buffer;
+
+        std::unique_ptr< queue::Context> queue_context( new queue::Context);
+        queue::Id queue_id;
+
+        size_t max_elements{ queue_length};
+        size_t type_size{ sizeof( Element< Size>)};
+
+        bool queue_created = queue::create( *queue_context, queue_id, max_elements, type_size, &buffer.m_data, nullptr);
+
+        REQUIRE( true == queue_created);
+
+        Element< Size> input[ queue_length]{};
+        Element< Size> output[ queue_length]{};
+
+        const auto start = std::chrono::steady_clock::now();
+
+        for ( size_t round = 0U; round < number_of_rounds; ++round)
+        {
+            ( void) queue::sendN( *queue_context, queue_id, input, queue_length);
+            ( void) queue::receiveN( *queue_context, queue_id, output, queue_length);
+        }
+
+        const auto stop = std::chrono::steady_clock::now();
+        const double elapsed_us = std::chrono::duration< double, std::micro>( stop - start).count();
+
+        queue::destroy( *queue_context, queue_id);
+
+        return static_cast< double>( number_of_rounds * queue_length) / elapsed_us;
+    }
+
+    template< size_t Size>
+    void printQueueThroughput()
+    {
+        const double elements_per_us = measureQueueThroughput< Size>();
+        const double typed_elements_per_us = measureTypedQueueThroughput< Size>();
+        const double batch_elements_per_us = measureBatchQueueThroughput< Size>();
+
+        std::cout
+            << std::setw( 6) << Size << " B | "
+            << std::setw( 10) << std::fixed << std::setprecision( 2) << elements_per_us << " elem/us | "
+            << std::setw( 10) << elements_per_us * Size << " MB/s | typed: "
+            << std::setw( 10) << typed_elements_per_us << " elem/us | batch: "
+            << std::setw( 10) << batch_elements_per_us << " elem/us\n";
+    }
+}
+
+TEST_CASE( "Queue throughput by element size", "[.][benchmark]")
+{
+    std::cout << "\nstatic_queue send + receive, queue length " << queue_length << ":\n";
+
+    printQueueThroughput< 1U>();
+    printQueueThroughput< 4U>();
+    printQueueThroughput< 8U>();
+    printQueueThroughput< 16U>();
+    printQueueThroughput< 32U>();
+    printQueueThroughput< 64U>();
+}
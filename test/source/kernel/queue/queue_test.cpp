@@ -18,7 +18,7 @@ TEST_CASE( "Queue")
             size_t max_buffer_size{ Max_buffer_size};
             size_t max_type_size{ sizeof( int32_t)};
 
-            volatile void * const static_buffer = &buffer.m_data;
+            void * const static_buffer = &buffer.m_data;
 
             bool queue_created = kernel::internal::queue::create(
                 queue_context,
@@ -41,7 +41,7 @@ TEST_CASE( "Queue")
             bool data_sent = kernel::internal::queue::send(
                 queue_context,
                 queue_id,
-                reinterpret_cast< volatile uint8_t*> ( &data_to_send)
+                reinterpret_cast< uint8_t*> ( &data_to_send)
             );
 
             REQUIRE( true == data_sent);
@@ -132,4 +132,600 @@ TEST_CASE( "Queue")
                 queue_context,
                 queue_id);
     }
+
+    SECTION ("Typed queue is visible to kernel through its indexes.")
+    {
+        constexpr size_t Max_buffer_size{ 4U};
+        kernel::static_queue::Typed< int32_t, Max_buffer_size> typed_queue;
+
+        kernel::internal::queue::Context queue_context;
+        kernel::internal::queue::Id queue_id;
+
+        bool queue_created = kernel::internal::queue::createTyped(
+            queue_context,
+            queue_id,
+            Max_buffer_size,
+            typed_queue.m_indexes,
+            nullptr
+        );
+
+        REQUIRE( true == queue_created);
+        REQUIRE( true == kernel::internal::queue::isEmpty( queue_context, queue_id));
+
+        // Fill up queue with typed send.
+        for ( int32_t i = 0; i < static_cast< int32_t>( Max_buffer_size); ++i)
+        {
+            REQUIRE( true == kernel::static_queue::send( typed_queue, i));
+            REQUIRE( false == kernel::internal::queue::isEmpty( queue_context, queue_id));
+        }
+
+        REQUIRE( true == kernel::internal::queue::isFull( queue_context, queue_id));
+        REQUIRE( Max_buffer_size == kernel::internal::queue::getSize( queue_context, queue_id));
+        REQUIRE( false == kernel::static_queue::send( typed_queue, 0x1234'567));
+
+        // Byte-wise API does not support typed queue.
+        {
+            int32_t data = 0;
+
+            REQUIRE( false == kernel::internal::queue::send( queue_context, queue_id, &data));
+            REQUIRE( false == kernel::internal::queue::receive( queue_context, queue_id, &data));
+        }
+
+        // Move indexes over buffer end few times.
+        for ( int32_t i = 0; i < 10; ++i)
+        {
+            int32_t received_data = -1;
+
+            REQUIRE( true == kernel::static_queue::receive( typed_queue, received_data));
+            REQUIRE( i == received_data);
+            REQUIRE( true == kernel::static_queue::send( typed_queue, i + static_cast< int32_t>( Max_buffer_size)));
+        }
+
+        for ( int32_t i = 10; i < 10 + static_cast< int32_t>( Max_buffer_size); ++i)
+        {
+            int32_t received_data = -1;
+
+            REQUIRE( true == kernel::static_queue::receive( typed_queue, received_data));
+            REQUIRE( i == received_data);
+        }
+
+        REQUIRE( true == kernel::internal::queue::isEmpty( queue_context, queue_id));
+        REQUIRE( 0U == kernel::static_queue::size( typed_queue));
+
+        kernel::internal::queue::destroy( queue_context, queue_id);
+    }
+
+    SECTION ("Batch send and receive around buffer end.")
+    {
+        constexpr size_t Max_buffer_size{ 8U};
+        kernel::static_queue::Buffer< uint8_t, Max_buffer_size> buffer;
+
+        kernel::internal::queue::Context queue_context;
+        kernel::internal::queue::Id queue_id;
+
+        size_t max_buffer_size{ Max_buffer_size};
+        size_t max_type_size{ sizeof( uint8_t)};
+
+        bool queue_created = kernel::internal::queue::create(
+            queue_context,
+            queue_id,
+            max_buffer_size,
+            max_type_size,
+            &buffer.m_data,
+            nullptr
+        );
+
+        REQUIRE( true == queue_created);
+
+        const uint8_t input[ 12]{ 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11};
+        uint8_t output[ 12]{};
+
+        // Move head and tail to the middle of buffer.
+        REQUIRE( 5U == kernel::internal::queue::sendN( queue_context, queue_id, input, 5U));
+        REQUIRE( 5U == kernel::internal::queue::receiveN( queue_context, queue_id, output, 5U));
+        REQUIRE( true == kernel::internal::queue::isEmpty( queue_context, queue_id));
+
+        // Send more than queue can hold. Data is split around buffer end.
+        REQUIRE( Max_buffer_size == kernel::internal::queue::sendN( queue_context, queue_id, input, 12U));
+        REQUIRE( true == kernel::internal::queue::isFull( queue_context, queue_id));
+        REQUIRE( 0U == kernel::internal::queue::sendN( queue_context, queue_id, input, 1U));
+
+        REQUIRE( 0 == buffer.m_data[ 5]);
+        REQUIRE( 2 == buffer.m_data[ 7]);
+        REQUIRE( 3 == buffer.m_data[ 0]);
+        REQUIRE( 7 == buffer.m_data[ 4]);
+
+        // Single element API follows batch API.
+        {
+            uint8_t data_to_receive = 0xCDU;
+
+            REQUIRE( true == kernel::internal::queue::receive( queue_context, queue_id, &data_to_receive));
+            REQUIRE( 0 == data_to_receive);
+
+            uint8_t data_to_send = 8U;
+
+            REQUIRE( true == kernel::internal::queue::send( queue_context, queue_id, &data_to_send));
+        }
+
+        // Receive more than queue holds.
+        REQUIRE( Max_buffer_size == kernel::internal::queue::receiveN( queue_context, queue_id, output, 12U));
+        REQUIRE( true == kernel::internal::queue::isEmpty( queue_context, queue_id));
+        REQUIRE( 0U == kernel::internal::queue::receiveN( queue_context, queue_id, output, 12U));
+
+        for ( size_t i = 0U; i < Max_buffer_size; ++i)
+        {
+            REQUIRE( input[ i + 1U] == output[ i]);
+        }
+
+        kernel::internal::queue::destroy( queue_context, queue_id);
+    }
+
+    SECTION ("Zero-copy reserve, commit, peek and consume.")
+    {
+        constexpr size_t Max_buffer_size{ 8U};
+        kernel::static_queue::Buffer< uint8_t, Max_buffer_size> buffer;
+
+        kernel::internal::queue::Context queue_context;
+        kernel::internal::queue::Id queue_id;
+
+        size_t max_buffer_size{ Max_buffer_size};
+        size_t max_type_size{ sizeof( uint8_t)};
+
+        bool queue_created = kernel::internal::queue::create(
+            queue_context,
+            queue_id,
+            max_buffer_size,
+            max_type_size,
+            &buffer.m_data,
+            nullptr
+        );
+
+        REQUIRE( true == queue_created);
+
+        size_t number_of_elements = 0U;
+
+        // Nothing to peek from empty queue.
+        REQUIRE( nullptr == kernel::internal::queue::peek( queue_context, queue_id, number_of_elements));
+        REQUIRE( 0U == number_of_elements);
+
+        // Write 6 elements in place.
+        {
+            uint8_t * p_free = kernel::internal::queue::reserve( queue_context, queue_id, number_of_elements);
+
+            REQUIRE( &buffer.m_data[ 0] == p_free);
+            REQUIRE( Max_buffer_size == number_of_elements);
+
+            for ( uint8_t i = 0U; i < 6U; ++i)
+            {
+                p_free[ i] = i;
+            }
+
+            // Reserved memory is not visible until commit.
+            REQUIRE( true == kernel::internal::queue::isEmpty( queue_context, queue_id));
+            REQUIRE( false == kernel::internal::queue::commit( queue_context, queue_id, Max_buffer_size + 1U));
+            REQUIRE( true == kernel::internal::queue::commit( queue_context, queue_id, 6U));
+            REQUIRE( 6U == kernel::internal::queue::getSize( queue_context, queue_id));
+        }
+
+        // Read 4 elements in place.
+        {
+            const uint8_t * p_used = kernel::internal::queue::peek( queue_context, queue_id, number_of_elements);
+
+            REQUIRE( &buffer.m_data[ 0] == p_used);
+            REQUIRE( 6U == number_of_elements);
+            REQUIRE( 3U == p_used[ 3]);
+
+            REQUIRE( true == kernel::internal::queue::consume( queue_context, queue_id, 4U));
+            REQUIRE( 2U == kernel::internal::queue::getSize( queue_context, queue_id));
+        }
+
+        // Free space is split by buffer end, so only linear part up to the end is returned.
+        {
+            uint8_t * p_free = kernel::internal::queue::reserve( queue_context, queue_id, number_of_elements);
+
+            REQUIRE( &buffer.m_data[ 6] == p_free);
+            REQUIRE( 2U == number_of_elements);
+
+            p_free[ 0] = 6U;
+            p_free[ 1] = 7U;
+
+            REQUIRE( false == kernel::internal::queue::commit( queue_context, queue_id, 3U));
+            REQUIRE( true == kernel::internal::queue::commit( queue_context, queue_id, 2U));
+
+            p_free = kernel::internal::queue::reserve( queue_context, queue_id, number_of_elements);
+
+            REQUIRE( &buffer.m_data[ 0] == p_free);
+            REQUIRE( 4U == number_of_elements);
+
+            p_free[ 0] = 8U;
+
+            REQUIRE( true == kernel::internal::queue::commit( queue_context, queue_id, 1U));
+        }
+
+        // Elements are received in order across buffer end.
+        for ( uint8_t i = 4U; i < 9U; ++i)
+        {
+            uint8_t data_to_receive = 0xCDU;
+
+            REQUIRE( true == kernel::internal::queue::receive( queue_context, queue_id, &data_to_receive));
+            REQUIRE( i == data_to_receive);
+        }
+
+        REQUIRE( true == kernel::internal::queue::isEmpty( queue_context, queue_id));
+        REQUIRE( false == kernel::internal::queue::consume( queue_context, queue_id, 1U));
+
+        kernel::internal::queue::destroy( queue_context, queue_id);
+    }
+
+    SECTION ("Direct handoff to registered receiver.")
+    {
+        constexpr size_t Max_buffer_size{ 2U};
+        kernel::static_queue::Buffer< int32_t, Max_buffer_size> buffer;
+
+        kernel::internal::queue::Context queue_context;
+        kernel::internal::queue::Id queue_id;
+
+        size_t max_buffer_size{ Max_buffer_size};
+        size_t max_type_size{ sizeof( int32_t)};
+
+        bool queue_created = kernel::internal::queue::create(
+            queue_context,
+            queue_id,
+            max_buffer_size,
+            max_type_size,
+            &buffer.m_data,
+            nullptr
+        );
+
+        REQUIRE( true == queue_created);
+
+        const kernel::Handle receiver{ 5U};
+        const kernel::Handle other_receiver{ 6U};
+
+        int32_t receiver_data = -1;
+        int32_t other_receiver_data = -1;
+
+        // Queue is empty, so receiver is registered.
+        REQUIRE( false == kernel::internal::queue::receiveOrRegister( queue_context, queue_id, &receiver_data, receiver));
+
+        // Only one receiver can be registered.
+        REQUIRE( false == kernel::internal::queue::receiveOrRegister( queue_context, queue_id, &other_receiver_data, other_receiver));
+
+        // Item is copied straight to receiver, skipping the queue buffer.
+        {
+            int32_t data_to_send = 0x1234;
+            kernel::Handle woken_receiver{};
+
+            REQUIRE( true == kernel::internal::queue::send( queue_context, queue_id, &data_to_send, &woken_receiver));
+            REQUIRE( receiver == woken_receiver);
+            REQUIRE( 0x1234 == receiver_data);
+            REQUIRE( true == kernel::internal::queue::isEmpty( queue_context, queue_id));
+            REQUIRE( true == kernel::internal::queue::isHandoffDone( queue_context, queue_id));
+
+            // Handed off item is not signaled to other waiters of the queue.
+            REQUIRE( false == kernel::internal::queue::isTriggered( queue_context, queue_id, 0U));
+            REQUIRE( true == kernel::internal::queue::isRegisteredReceiver( queue_context, queue_id, receiver));
+            REQUIRE( false == kernel::internal::queue::isRegisteredReceiver( queue_context, queue_id, other_receiver));
+        }
+
+        // Next item goes to the queue buffer.
+        {
+            int32_t data_to_send = 0x5678;
+            kernel::Handle woken_receiver{ 7U};
+
+            REQUIRE( true == kernel::internal::queue::send( queue_context, queue_id, &data_to_send, &woken_receiver));
+            REQUIRE( kernel::Handle{ 7U} == woken_receiver);
+            REQUIRE( 1U == kernel::internal::queue::getSize( queue_context, queue_id));
+        }
+
+        REQUIRE( false == kernel::internal::queue::unregisterReceiver( queue_context, queue_id, other_receiver));
+        REQUIRE( true == kernel::internal::queue::unregisterReceiver( queue_context, queue_id, receiver));
+        REQUIRE( false == kernel::internal::queue::isHandoffDone( queue_context, queue_id));
+        REQUIRE( false == kernel::internal::queue::isRegisteredReceiver( queue_context, queue_id, receiver));
+
+        // Queue is not empty, so item is received as usual.
+        REQUIRE( true == kernel::internal::queue::receiveOrRegister( queue_context, queue_id, &other_receiver_data, other_receiver));
+        REQUIRE( 0x5678 == other_receiver_data);
+
+        // Receiver, which timed out without handoff, does not get any data.
+        receiver_data = -1;
+
+        REQUIRE( false == kernel::internal::queue::receiveOrRegister( queue_context, queue_id, &receiver_data, receiver));
+        REQUIRE( false == kernel::internal::queue::unregisterReceiver( queue_context, queue_id, receiver));
+
+        {
+            int32_t data_to_send = 0x9ABC;
+
+            REQUIRE( true == kernel::internal::queue::send( queue_context, queue_id, &data_to_send));
+            REQUIRE( -1 == receiver_data);
+            REQUIRE( 1U == kernel::internal::queue::getSize( queue_context, queue_id));
+        }
+
+        kernel::internal::queue::destroy( queue_context, queue_id);
+    }
+
+    SECTION ("Registration of terminated task is cleared.")
+    {
+        constexpr size_t Max_buffer_size{ 2U};
+        kernel::static_queue::Buffer< int32_t, Max_buffer_size> buffer;
+
+        kernel::internal::queue::Context queue_context;
+        kernel::internal::queue::Id queue_id;
+
+        size_t max_buffer_size{ Max_buffer_size};
+        size_t max_type_size{ sizeof( int32_t)};
+
+        bool queue_created = kernel::internal::queue::create(
+            queue_context,
+            queue_id,
+            max_buffer_size,
+            max_type_size,
+            &buffer.m_data,
+            nullptr
+        );
+
+        REQUIRE( true == queue_created);
+
+        const kernel::Handle receiver{ 5U};
+        const kernel::Handle other_task{ 6U};
+
+        int32_t receiver_data = -1;
+
+        REQUIRE( false == kernel::internal::queue::receiveOrRegister( queue_context, queue_id, &receiver_data, receiver));
+
+        // Other task does not affect registration.
+        kernel::internal::queue::unregisterTask( queue_context, other_task);
+
+        REQUIRE( true == kernel::internal::queue::isRegisteredReceiver( queue_context, queue_id, receiver));
+
+        kernel::internal::queue::unregisterTask( queue_context, receiver);
+
+        REQUIRE( false == kernel::internal::queue::isRegisteredReceiver( queue_context, queue_id, receiver));
+
+        // Item goes to the queue buffer, not to the stack of terminated task.
+        {
+            int32_t data_to_send = 0x1234;
+            kernel::Handle woken_receiver{ 7U};
+
+            REQUIRE( true == kernel::internal::queue::send( queue_context, queue_id, &data_to_send, &woken_receiver));
+            REQUIRE( kernel::Handle{ 7U} == woken_receiver);
+            REQUIRE( -1 == receiver_data);
+            REQUIRE( 1U == kernel::internal::queue::getSize( queue_context, queue_id));
+            REQUIRE( false == kernel::internal::queue::isHandoffDone( queue_context, queue_id));
+        }
+
+        // Pending handoff of terminated task is dropped too, so next receiver can register.
+        {
+            int32_t data = 0;
+
+            REQUIRE( true == kernel::internal::queue::receiveOrRegister( queue_context, queue_id, &data, other_task));
+            REQUIRE( false == kernel::internal::queue::receiveOrRegister( queue_context, queue_id, &receiver_data, receiver));
+
+            int32_t data_to_send = 0x5678;
+
+            REQUIRE( true == kernel::internal::queue::send( queue_context, queue_id, &data_to_send));
+            REQUIRE( true == kernel::internal::queue::isHandoffDone( queue_context, queue_id));
+
+            kernel::internal::queue::unregisterTask( queue_context, receiver);
+
+            REQUIRE( false == kernel::internal::queue::isHandoffDone( queue_context, queue_id));
+            REQUIRE( false == kernel::internal::queue::receiveOrRegister( queue_context, queue_id, &data, other_task));
+            REQUIRE( true == kernel::internal::queue::isRegisteredReceiver( queue_context, queue_id, other_task));
+        }
+
+        kernel::internal::queue::destroy( queue_context, queue_id);
+    }
+
+    SECTION ("Send to front is received before older items.")
+    {
+        constexpr size_t Max_buffer_size{ 4U};
+        kernel::static_queue::Buffer< int32_t, Max_buffer_size> buffer;
+
+        kernel::internal::queue::Context queue_context;
+        kernel::internal::queue::Id queue_id;
+
+        size_t max_buffer_size{ Max_buffer_size};
+        size_t max_type_size{ sizeof( int32_t)};
+
+        bool queue_created = kernel::internal::queue::create(
+            queue_context,
+            queue_id,
+            max_buffer_size,
+            max_type_size,
+            &buffer.m_data,
+            nullptr
+        );
+
+        REQUIRE( true == queue_created);
+
+        // Tail is at the buffer beginning, so urgent item is stored at the buffer end.
+        int32_t data_to_send = 1;
+        REQUIRE( true == kernel::internal::queue::send( queue_context, queue_id, &data_to_send));
+        data_to_send = 2;
+        REQUIRE( true == kernel::internal::queue::send( queue_context, queue_id, &data_to_send));
+        data_to_send = 100;
+        REQUIRE( true == kernel::internal::queue::sendToFront( queue_context, queue_id, &data_to_send));
+        REQUIRE( 100 == buffer.m_data[ Max_buffer_size - 1U]);
+        data_to_send = 101;
+        REQUIRE( true == kernel::internal::queue::sendToFront( queue_context, queue_id, &data_to_send));
+
+        REQUIRE( true == kernel::internal::queue::isFull( queue_context, queue_id));
+        REQUIRE( false == kernel::internal::queue::sendToFront( queue_context, queue_id, &data_to_send));
+
+        for ( int32_t expected_data : { 101, 100, 1, 2})
+        {
+            int32_t received_data = -1;
+
+            REQUIRE( true == kernel::internal::queue::receive( queue_context, queue_id, &received_data));
+            REQUIRE( expected_data == received_data);
+        }
+
+        REQUIRE( true == kernel::internal::queue::isEmpty( queue_context, queue_id));
+
+        kernel::internal::queue::destroy( queue_context, queue_id);
+    }
+
+    SECTION ("Waiter is signaled at trigger level or after batch timeout.")
+    {
+        constexpr size_t Max_buffer_size{ 8U};
+        kernel::static_queue::Buffer< uint8_t, Max_buffer_size> buffer;
+
+        kernel::internal::queue::Context queue_context;
+        kernel::internal::queue::Id queue_id;
+
+        size_t max_buffer_size{ Max_buffer_size};
+        size_t max_type_size{ sizeof( uint8_t)};
+
+        bool queue_created = kernel::internal::queue::create(
+            queue_context,
+            queue_id,
+            max_buffer_size,
+            max_type_size,
+            &buffer.m_data,
+            nullptr
+        );
+
+        REQUIRE( true == queue_created);
+
+        const uint8_t data[ Max_buffer_size]{};
+        uint8_t received_data[ Max_buffer_size]{};
+
+        // By default, the first item signals the waiter.
+        REQUIRE( false == kernel::internal::queue::isTriggered( queue_context, queue_id, 0U));
+        REQUIRE( 1U == kernel::internal::queue::sendN( queue_context, queue_id, data, 1U));
+        REQUIRE( true == kernel::internal::queue::isTriggered( queue_context, queue_id, 0U));
+        REQUIRE( 1U == kernel::internal::queue::receiveN( queue_context, queue_id, received_data, 1U));
+
+        // Trigger level without timeout.
+        kernel::internal::queue::setTriggerLevel( queue_context, queue_id, 4U, false, 0U);
+
+        REQUIRE( 3U == kernel::internal::queue::sendN( queue_context, queue_id, data, 3U));
+        REQUIRE( false == kernel::internal::queue::isTriggered( queue_context, queue_id, 1000U));
+        REQUIRE( 1U == kernel::internal::queue::sendN( queue_context, queue_id, data, 1U));
+        REQUIRE( true == kernel::internal::queue::isTriggered( queue_context, queue_id, 1000U));
+        REQUIRE( 4U == kernel::internal::queue::receiveN( queue_context, queue_id, received_data, 4U));
+
+        // Trigger level above queue size is reached by full queue.
+        kernel::internal::queue::setTriggerLevel( queue_context, queue_id, 100U, false, 0U);
+
+        REQUIRE( 7U == kernel::internal::queue::sendN( queue_context, queue_id, data, 7U));
+        REQUIRE( false == kernel::internal::queue::isTriggered( queue_context, queue_id, 0U));
+        REQUIRE( 1U == kernel::internal::queue::sendN( queue_context, queue_id, data, 1U));
+        REQUIRE( true == kernel::internal::queue::isTriggered( queue_context, queue_id, 0U));
+        REQUIRE( 8U == kernel::internal::queue::receiveN( queue_context, queue_id, received_data, 8U));
+
+        // Batch timeout is measured from the first test of unconsumed item.
+        kernel::internal::queue::setTriggerLevel( queue_context, queue_id, 4U, true, 10U);
+
+        REQUIRE( 1U == kernel::internal::queue::sendN( queue_context, queue_id, data, 1U));
+        REQUIRE( false == kernel::internal::queue::isTriggered( queue_context, queue_id, 100U));
+        REQUIRE( false == kernel::internal::queue::isTriggered( queue_context, queue_id, 109U));
+        REQUIRE( true == kernel::internal::queue::isTriggered( queue_context, queue_id, 110U));
+
+        // Emptied queue restarts batch timeout.
+        REQUIRE( 1U == kernel::internal::queue::receiveN( queue_context, queue_id, received_data, 1U));
+        REQUIRE( 1U == kernel::internal::queue::sendN( queue_context, queue_id, data, 1U));
+        REQUIRE( false == kernel::internal::queue::isTriggered( queue_context, queue_id, 200U));
+        REQUIRE( true == kernel::internal::queue::isTriggered( queue_context, queue_id, 210U));
+
+        // Timeout works across system time wrap-around.
+        REQUIRE( 1U == kernel::internal::queue::receiveN( queue_context, queue_id, received_data, 1U));
+        REQUIRE( 1U == kernel::internal::queue::sendN( queue_context, queue_id, data, 1U));
+        REQUIRE( false == kernel::internal::queue::isTriggered( queue_context, queue_id, 0xFFFF'FFFCU));
+        REQUIRE( true == kernel::internal::queue::isTriggered( queue_context, queue_id, 6U));
+
+        // Receiver is not registered for direct handoff of single item.
+        REQUIRE( 1U == kernel::internal::queue::receiveN( queue_context, queue_id, received_data, 1U));
+
+        const kernel::Handle receiver{ 1U};
+
+        REQUIRE( false == kernel::internal::queue::receiveOrRegister( queue_context, queue_id, received_data, receiver));
+
+        kernel::Handle woken_receiver{ 0x0003'0000U};
+
+        REQUIRE( true == kernel::internal::queue::send( queue_context, queue_id, data, &woken_receiver));
+        REQUIRE( kernel::Handle{ 0x0003'0000U} == woken_receiver);
+        REQUIRE( false == kernel::internal::queue::isHandoffDone( queue_context, queue_id));
+
+        kernel::internal::queue::destroy( queue_context, queue_id);
+    }
+
+    SECTION ("Statistics count sends, drops, receives and time spent full.")
+    {
+        static_assert( kernel::internal::queue::stats_enable, "Tests require KERNEL_QUEUE_STATS_ENABLE.");
+
+        constexpr size_t Max_buffer_size{ 4U};
+        kernel::static_queue::Buffer< uint8_t, Max_buffer_size> buffer;
+
+        kernel::internal::queue::Context queue_context;
+        kernel::internal::queue::Id queue_id;
+
+        size_t max_buffer_size{ Max_buffer_size};
+        size_t max_type_size{ sizeof( uint8_t)};
+
+        bool queue_created = kernel::internal::queue::create(
+            queue_context,
+            queue_id,
+            max_buffer_size,
+            max_type_size,
+            &buffer.m_data,
+            nullptr
+        );
+
+        REQUIRE( true == queue_created);
+
+        const uint8_t data[ 6]{};
+        uint8_t received_data[ 6]{};
+
+        kernel::internal::queue::tickStats( queue_context, 10U);
+
+        // Elements which do not fit are dropped.
+        REQUIRE( 3U == kernel::internal::queue::sendN( queue_context, queue_id, data, 3U));
+        REQUIRE( 1U == kernel::internal::queue::sendN( queue_context, queue_id, data, 3U));
+        REQUIRE( false == kernel::internal::queue::send( queue_context, queue_id, data));
+
+        // Blocking send counts its drop only when it times out.
+        REQUIRE( false == kernel::internal::queue::send( queue_context, queue_id, data, nullptr, false));
+
+        // Time full is added between samples, even when ticks were skipped.
+        kernel::internal::queue::tickStats( queue_context, 15U);
+
+        REQUIRE( 2U == kernel::internal::queue::receiveN( queue_context, queue_id, received_data, 2U));
+        kernel::internal::queue::tickStats( queue_context, 20U);
+
+        kernel::static_queue::Stats stats;
+        kernel::internal::queue::getStats( queue_context, queue_id, stats);
+
+        REQUIRE( 4U == stats.m_peak_size);
+        REQUIRE( 3U == stats.m_dropped_sends);
+        REQUIRE( 4U == stats.m_total_sends);
+        REQUIRE( 2U == stats.m_total_receives);
+        REQUIRE( 5U == stats.m_time_full);
+
+        // Handed off item is counted as sent and received.
+        REQUIRE( 2U == kernel::internal::queue::receiveN( queue_context, queue_id, received_data, 2U));
+
+        const kernel::Handle receiver{ 5U};
+
+        REQUIRE( false == kernel::internal::queue::receiveOrRegister( queue_context, queue_id, received_data, receiver));
+        REQUIRE( true == kernel::internal::queue::send( queue_context, queue_id, data));
+
+        kernel::internal::queue::getStats( queue_context, queue_id, stats);
+
+        REQUIRE( 5U == stats.m_total_sends);
+        REQUIRE( 5U == stats.m_total_receives);
+
+        // Reset keeps current size as peak.
+        REQUIRE( true == kernel::internal::queue::unregisterReceiver( queue_context, queue_id, receiver));
+        REQUIRE( true == kernel::internal::queue::send( queue_context, queue_id, data));
+
+        kernel::internal::queue::resetStats( queue_context, queue_id);
+        kernel::internal::queue::getStats( queue_context, queue_id, stats);
+
+        REQUIRE( 1U == stats.m_peak_size);
+        REQUIRE( 0U == stats.m_total_sends);
+        REQUIRE( 0U == stats.m_time_full);
+
+        kernel::internal::queue::destroy( queue_context, queue_id);
+    }
 }
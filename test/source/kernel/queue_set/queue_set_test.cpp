@@ -0,0 +1,203 @@
+#include "catch.hpp"
+
+#include "queue_set/queue_set.hpp"
+
+#include <memory>
+
+TEST_CASE( "QueueSet")
+{
+    using namespace kernel::internal;
+
+    std::unique_ptr< queue_set::Context> context( new queue_set::Context);
+
+    const kernel::Handle receiver{ 0x0000'0005U};
+
+    auto member_handle = []( uint32_t a_slot)
+    {
+        return static_cast< kernel::Handle>( 0x0100'0000U | a_slot);
+    };
+
+    SECTION ( "Ready members are selected in FIFO order, each at most once.")
+    {
+        queue_set::Id set_id;
+
+        REQUIRE( true == queue_set::create( *context, set_id));
+        REQUIRE( true == queue_set::isEmpty( *context, set_id));
+
+        for ( uint32_t slot = 0U; slot < queue_set::max_members; ++slot)
+        {
+            REQUIRE( true == queue_set::addMember( *context, set_id, slot, member_handle( slot)));
+        }
+
+        // Member can belong to single set only.
+        REQUIRE( false == queue_set::addMember( *context, set_id, 0U, member_handle( 0U)));
+
+        const uint32_t ready_order[]{ 2U, 0U, 2U, 1U};
+
+        for ( uint32_t slot : ready_order)
+        {
+            queue_set::notify( *context, slot, nullptr);
+        }
+
+        REQUIRE( false == queue_set::isEmpty( *context, set_id));
+
+        const uint32_t expected_order[]{ 2U, 0U, 1U};
+
+        for ( uint32_t expected_slot : expected_order)
+        {
+            kernel::Handle member{};
+            uint32_t slot = queue_set::no_slot;
+
+            REQUIRE( true == queue_set::pop( *context, set_id, member, slot));
+            REQUIRE( expected_slot == slot);
+            REQUIRE( member_handle( expected_slot) == member);
+        }
+
+        kernel::Handle member{};
+        uint32_t slot = queue_set::no_slot;
+
+        REQUIRE( false == queue_set::pop( *context, set_id, member, slot));
+        REQUIRE( true == queue_set::isEmpty( *context, set_id));
+
+        // The last popped member is remembered, so it can be queued again.
+        REQUIRE( true == queue_set::takeLastSelected( *context, set_id, member, slot));
+        REQUIRE( 1U == slot);
+        REQUIRE( member_handle( 1U) == member);
+        REQUIRE( false == queue_set::takeLastSelected( *context, set_id, member, slot));
+
+        queue_set::destroy( *context, set_id);
+    }
+
+    SECTION ( "Removed member leaves ready FIFO.")
+    {
+        queue_set::Id set_id;
+
+        REQUIRE( true == queue_set::create( *context, set_id));
+
+        for ( uint32_t slot = 0U; slot < 3U; ++slot)
+        {
+            REQUIRE( true == queue_set::addMember( *context, set_id, slot, member_handle( slot)));
+            queue_set::notify( *context, slot, nullptr);
+        }
+
+        // Remove from the middle and from the tail of FIFO.
+        REQUIRE( true == queue_set::removeMember( *context, 1U));
+        REQUIRE( true == queue_set::removeMember( *context, 2U));
+        REQUIRE( false == queue_set::removeMember( *context, 2U));
+        REQUIRE( false == queue_set::isMember( *context, 2U, set_id));
+
+        // Notification of former member is ignored.
+        queue_set::notify( *context, 1U, nullptr);
+
+        kernel::Handle member{};
+        uint32_t slot = queue_set::no_slot;
+
+        REQUIRE( true == queue_set::pop( *context, set_id, member, slot));
+        REQUIRE( 0U == slot);
+        REQUIRE( false == queue_set::pop( *context, set_id, member, slot));
+
+        // Tail was updated, so FIFO works after removal.
+        REQUIRE( true == queue_set::addMember( *context, set_id, 2U, member_handle( 2U)));
+        queue_set::notify( *context, 2U, nullptr);
+        queue_set::notify( *context, 0U, nullptr);
+
+        REQUIRE( true == queue_set::pop( *context, set_id, member, slot));
+        REQUIRE( 2U == slot);
+        REQUIRE( true == queue_set::pop( *context, set_id, member, slot));
+        REQUIRE( 0U == slot);
+    }
+
+    SECTION ( "Members, which are not ready anymore, are dropped from the head of FIFO.")
+    {
+        queue_set::Id set_id;
+
+        REQUIRE( true == queue_set::create( *context, set_id));
+
+        for ( uint32_t slot = 0U; slot < 3U; ++slot)
+        {
+            REQUIRE( true == queue_set::addMember( *context, set_id, slot, member_handle( slot)));
+            queue_set::notify( *context, slot, nullptr);
+        }
+
+        // Members 0 and 2 were drained without select.
+        auto is_member_ready = [ &member_handle]( const kernel::Handle & a_member)
+        {
+            return ( member_handle( 1U) == a_member);
+        };
+
+        REQUIRE( true == queue_set::hasReadyMember( *context, set_id, is_member_ready));
+
+        kernel::Handle member{};
+        uint32_t slot = queue_set::no_slot;
+
+        REQUIRE( true == queue_set::pop( *context, set_id, member, slot));
+        REQUIRE( 1U == slot);
+
+        // Only stale member is left, so set is not signaled.
+        REQUIRE( false == queue_set::isEmpty( *context, set_id));
+        REQUIRE( false == queue_set::hasReadyMember( *context, set_id, is_member_ready));
+        REQUIRE( true == queue_set::isEmpty( *context, set_id));
+
+        // Dropped member is queued again, when it becomes ready.
+        queue_set::notify( *context, 2U, nullptr);
+
+        REQUIRE( true == queue_set::pop( *context, set_id, member, slot));
+        REQUIRE( 2U == slot);
+        REQUIRE( false == queue_set::pop( *context, set_id, member, slot));
+    }
+
+    SECTION ( "Registered receiver is returned by the first notification.")
+    {
+        queue_set::Id set_id;
+
+        REQUIRE( true == queue_set::create( *context, set_id));
+        REQUIRE( true == queue_set::addMember( *context, set_id, 0U, member_handle( 0U)));
+        REQUIRE( true == queue_set::addMember( *context, set_id, 1U, member_handle( 1U)));
+
+        kernel::Handle member{};
+        uint32_t slot = queue_set::no_slot;
+
+        REQUIRE( false == queue_set::popOrRegister( *context, set_id, member, slot, receiver));
+
+        kernel::Handle woken_receiver = member_handle( 0U);
+
+        queue_set::notify( *context, 0U, &woken_receiver);
+        REQUIRE( receiver == woken_receiver);
+
+        // Receiver is woken up only once.
+        woken_receiver = member_handle( 1U);
+
+        queue_set::notify( *context, 1U, &woken_receiver);
+        REQUIRE( member_handle( 1U) == woken_receiver);
+
+        REQUIRE( true == queue_set::popOrRegister( *context, set_id, member, slot, receiver));
+        REQUIRE( member_handle( 0U) == member);
+
+        // Unregistered receiver is not returned.
+        REQUIRE( true == queue_set::pop( *context, set_id, member, slot));
+        REQUIRE( false == queue_set::popOrRegister( *context, set_id, member, slot, receiver));
+
+        queue_set::unregisterReceiver( *context, set_id);
+
+        woken_receiver = member_handle( 0U);
+
+        queue_set::notify( *context, 0U, &woken_receiver);
+        REQUIRE( member_handle( 0U) == woken_receiver);
+    }
+
+    SECTION ( "Destroyed set releases its members.")
+    {
+        queue_set::Id first_set_id;
+        queue_set::Id second_set_id;
+
+        REQUIRE( true == queue_set::create( *context, first_set_id));
+        REQUIRE( true == queue_set::addMember( *context, first_set_id, 0U, member_handle( 0U)));
+        queue_set::notify( *context, 0U, nullptr);
+
+        queue_set::destroy( *context, first_set_id);
+
+        REQUIRE( true == queue_set::create( *context, second_set_id));
+        REQUIRE( true == queue_set::addMember( *context, second_set_id, 0U, member_handle( 0U)));
+        REQUIRE( true == queue_set::isEmpty( *context, second_set_id));
+    }
+}
@@ -0,0 +1,175 @@
+#include "catch.hpp"
+
+#include "registry/registry.hpp"
+
+TEST_CASE( "Registry")
+{
+    using namespace kernel::internal;
+
+    registry::Context context;
+
+    const kernel::Handle first_handle{ 0x0003'0001U};
+    const kernel::Handle second_handle{ 0x0003'0002U};
+
+    SECTION ( "Named objects are found by name.")
+    {
+        constexpr kernel::Name first_name{ "first"};
+        constexpr kernel::Name second_name{ "second"};
+
+        REQUIRE( true == registry::add( context, first_name, first_handle));
+        REQUIRE( true == registry::add( context, second_name, second_handle));
+
+        kernel::Handle found_handle{};
+
+        REQUIRE( true == registry::find( context, first_name, found_handle));
+        REQUIRE( first_handle == found_handle);
+
+        REQUIRE( true == registry::find( context, second_name, found_handle));
+        REQUIRE( second_handle == found_handle);
+
+        REQUIRE( false == registry::find( context, kernel::Name{ "third"}, found_handle));
+
+        // Name must be unique.
+        REQUIRE( false == registry::add( context, first_name, second_handle));
+
+        registry::remove( context, first_name);
+
+        REQUIRE( false == registry::find( context, first_name, found_handle));
+        REQUIRE( true == registry::add( context, first_name, second_handle));
+    }
+
+    SECTION ( "Name string is compared when pointers differ.")
+    {
+        const char registered_name[] = "queue";
+        const char looked_up_name[] = "queue";
+
+        REQUIRE( &registered_name[ 0] != &looked_up_name[ 0]);
+
+        REQUIRE( true == registry::add( context, kernel::Name{ registered_name}, first_handle));
+
+        kernel::Handle found_handle{};
+
+        REQUIRE( true == registry::find( context, kernel::Name{ looked_up_name}, found_handle));
+        REQUIRE( first_handle == found_handle);
+    }
+
+    SECTION ( "Colliding names are told apart and removal keeps probe sequence.")
+    {
+        // Force all names into the same home entry and hash.
+        kernel::Name names[]{ kernel::Name{ "a"}, kernel::Name{ "b"}, kernel::Name{ "c"}};
+
+        for ( kernel::Name & name : names)
+        {
+            name.m_hash = registry::max_number - 1U;
+        }
+
+        for ( uint32_t i = 0U; i < 3U; ++i)
+        {
+            REQUIRE( true == registry::add( context, names[ i], kernel::Handle{ i}));
+        }
+
+        // Probe sequence wraps around the end of table.
+        REQUIRE( names[ 1].mp_string == context.m_entries[ 0U].mp_name);
+
+        registry::remove( context, names[ 0]);
+
+        // Following entries were shifted back into removed entry.
+        REQUIRE( names[ 1].mp_string == context.m_entries[ registry::max_number - 1U].mp_name);
+        REQUIRE( nullptr == context.m_entries[ 1U].mp_name);
+
+        kernel::Handle found_handle{};
+
+        REQUIRE( false == registry::find( context, names[ 0], found_handle));
+
+        REQUIRE( true == registry::find( context, names[ 1], found_handle));
+        REQUIRE( kernel::Handle{ 1U} == found_handle);
+
+        REQUIRE( true == registry::find( context, names[ 2], found_handle));
+        REQUIRE( kernel::Handle{ 2U} == found_handle);
+    }
+
+    SECTION ( "Full registry rejects new names.")
+    {
+        char names[ registry::max_number + 1U][ 4]{};
+        bool all_added = true;
+
+        for ( uint32_t i = 0U; i < registry::max_number; ++i)
+        {
+            names[ i][ 0] = static_cast< char>( 'A' + i);
+            all_added &= registry::add( context, kernel::Name{ names[ i]}, kernel::Handle{ i});
+        }
+
+        REQUIRE( true == all_added);
+
+        names[ registry::max_number][ 0] = 'a';
+        REQUIRE( false == registry::add( context, kernel::Name{ names[ registry::max_number]}, first_handle));
+
+        kernel::Handle bound_handle{};
+        REQUIRE( false == registry::bind( context, kernel::Name{ names[ registry::max_number]}, bound_handle));
+
+        // Lookup of missing name ends after single pass through full table.
+        kernel::Handle found_handle{};
+        REQUIRE( false == registry::find( context, kernel::Name{ names[ registry::max_number]}, found_handle));
+
+        // Removal from full table keeps other names.
+        registry::remove( context, kernel::Name{ names[ 0]});
+
+        REQUIRE( true == registry::find( context, kernel::Name{ names[ registry::max_number - 1U]}, found_handle));
+        REQUIRE( kernel::Handle{ registry::max_number - 1U} == found_handle);
+    }
+
+    SECTION ( "Bound handle is written when object is registered.")
+    {
+        constexpr kernel::Name name{ "rx"};
+
+        kernel::Handle bound_handle{};
+
+        // Bind before object exists.
+        REQUIRE( true == registry::bind( context, name, bound_handle));
+        REQUIRE( kernel::Handle{} == bound_handle);
+
+        kernel::Handle found_handle{};
+        REQUIRE( false == registry::find( context, name, found_handle));
+
+        REQUIRE( true == registry::add( context, name, first_handle));
+        REQUIRE( first_handle == bound_handle);
+
+        // Binding is reset after object is removed, kept and written again for new object.
+        registry::remove( context, name);
+        REQUIRE( false == registry::find( context, name, found_handle));
+        REQUIRE( kernel::Handle{} == bound_handle);
+
+        REQUIRE( true == registry::add( context, name, second_handle));
+        REQUIRE( second_handle == bound_handle);
+
+        // Bind after object exists.
+        constexpr kernel::Name other_name{ "tx"};
+        kernel::Handle late_bound_handle{};
+
+        REQUIRE( true == registry::add( context, other_name, first_handle));
+        REQUIRE( true == registry::bind( context, other_name, late_bound_handle));
+        REQUIRE( first_handle == late_bound_handle);
+    }
+
+    SECTION ( "Bound name cannot be bound to other handle.")
+    {
+        constexpr kernel::Name name{ "rx"};
+
+        kernel::Handle bound_handle{};
+        kernel::Handle other_handle{};
+
+        REQUIRE( true == registry::bind( context, name, bound_handle));
+
+        // Binding the same handle again is allowed.
+        REQUIRE( true == registry::bind( context, name, bound_handle));
+        REQUIRE( false == registry::bind( context, name, other_handle));
+
+        REQUIRE( true == registry::add( context, name, first_handle));
+        REQUIRE( first_handle == bound_handle);
+        REQUIRE( kernel::Handle{} == other_handle);
+
+        // Registered object does not release binding either.
+        REQUIRE( false == registry::bind( context, name, other_handle));
+        REQUIRE( kernel::Handle{} == other_handle);
+    }
+}
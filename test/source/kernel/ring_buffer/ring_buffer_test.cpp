@@ -0,0 +1,143 @@
+#include "catch.hpp"
+
+#include "ring_buffer/ring_buffer.hpp"
+
+#include <thread>
+
+TEST_CASE( "RingBuffer")
+{
+    using namespace kernel::internal;
+
+    SECTION ( "Create new ring buffer, add and remove items.")
+    {
+        constexpr size_t Max_buffer_size{ 4U};
+        kernel::ring_buffer::Buffer< int32_t, Max_buffer_size> buffer;
+
+        ring_buffer::Context context;
+        ring_buffer::Id id;
+
+        bool ring_buffer_created = ring_buffer::create(
+            context,
+            id,
+            Max_buffer_size,
+            sizeof( int32_t),
+            &buffer.m_data
+        );
+
+        REQUIRE( true == ring_buffer_created);
+        REQUIRE( true == ring_buffer::isEmpty( context, id));
+
+        // Fill up ring buffer. No slot is reserved to tell full from empty.
+        for ( int32_t i = 0; i < static_cast< int32_t>( Max_buffer_size); ++i)
+        {
+            REQUIRE( true == ring_buffer::send( context, id, &i));
+            REQUIRE( i == buffer.m_data[ i]);
+        }
+
+        REQUIRE( true == ring_buffer::isFull( context, id));
+        REQUIRE( Max_buffer_size == ring_buffer::getSize( context, id));
+
+        // Try adding item to full ring buffer.
+        {
+            int32_t data_to_send = 0x1234'567;
+            REQUIRE( false == ring_buffer::send( context, id, &data_to_send));
+        }
+
+        // Items are received in the same order.
+        for ( int32_t i = 0; i < static_cast< int32_t>( Max_buffer_size); ++i)
+        {
+            int32_t received_data = -1;
+
+            REQUIRE( true == ring_buffer::receive( context, id, &received_data));
+            REQUIRE( i == received_data);
+        }
+
+        REQUIRE( true == ring_buffer::isEmpty( context, id));
+
+        // Try removing item from empty ring buffer.
+        {
+            int32_t received_data = -1;
+
+            REQUIRE( false == ring_buffer::receive( context, id, &received_data));
+            REQUIRE( -1 == received_data);
+        }
+    }
+
+    SECTION ( "Indexes wrap around buffer end.")
+    {
+        constexpr size_t Max_buffer_size{ 4U};
+        kernel::ring_buffer::Buffer< uint8_t, Max_buffer_size> buffer;
+
+        ring_buffer::Context context;
+        ring_buffer::Id id;
+
+        REQUIRE( true == ring_buffer::create( context, id, Max_buffer_size, sizeof( uint8_t), &buffer.m_data));
+
+        // Keep 3 items in buffer, while moving indexes over buffer end many times.
+        uint8_t next_to_send = 0U;
+        uint8_t next_to_receive = 0U;
+
+        for ( int i = 0; i < 3; ++i)
+        {
+            REQUIRE( true == ring_buffer::send( context, id, &next_to_send));
+            ++next_to_send;
+        }
+
+        for ( int i = 0; i < 1000; ++i)
+        {
+            REQUIRE( true == ring_buffer::send( context, id, &next_to_send));
+            ++next_to_send;
+
+            uint8_t received_data{};
+
+            REQUIRE( true == ring_buffer::receive( context, id, &received_data));
+            REQUIRE( next_to_receive == received_data);
+            ++next_to_receive;
+
+            REQUIRE( 3U == ring_buffer::getSize( context, id));
+        }
+    }
+
+    SECTION ( "Concurrent producer and consumer.")
+    {
+        constexpr size_t Max_buffer_size{ 8U};
+        constexpr uint32_t Number_of_items{ 100'000U};
+
+        kernel::ring_buffer::Buffer< uint32_t, Max_buffer_size> buffer;
+
+        ring_buffer::Context context;
+        ring_buffer::Id id;
+
+        REQUIRE( true == ring_buffer::create( context, id, Max_buffer_size, sizeof( uint32_t), &buffer.m_data));
+
+        // Producer thread stands for interrupt routine.
+        std::thread producer( [ &]()
+        {
+            for ( uint32_t i = 0U; i < Number_of_items; )
+            {
+                if ( true == ring_buffer::send( context, id, &i))
+                {
+                    ++i;
+                }
+            }
+        });
+
+        bool items_in_order = true;
+
+        for ( uint32_t expected = 0U; expected < Number_of_items; )
+        {
+            uint32_t received_data{};
+
+            if ( true == ring_buffer::receive( context, id, &received_data))
+            {
+                items_in_order &= ( expected == received_data);
+                ++expected;
+            }
+        }
+
+        producer.join();
+
+        REQUIRE( true == items_in_order);
+        REQUIRE( true == ring_buffer::isEmpty( context, id));
+    }
+}
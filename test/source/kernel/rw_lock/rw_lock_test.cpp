@@ -0,0 +1,90 @@
+#include "catch.hpp"
+
+#include "rw_lock/rw_lock.hpp"
+
+TEST_CASE( "RwLock")
+{
+    using namespace kernel::internal;
+
+    rw_lock::Context context;
+
+    SECTION ( "Readers share lock, writer holds it alone.")
+    {
+        rw_lock::Id id;
+
+        REQUIRE( true == rw_lock::create( context, id, kernel::rw_lock::Policy::PreferWriter));
+
+        REQUIRE( true == rw_lock::tryLockRead( context, id));
+        REQUIRE( true == rw_lock::tryLockRead( context, id));
+        REQUIRE( 2U == rw_lock::getReaders( context, id));
+
+        REQUIRE( false == rw_lock::tryLockWrite( context, id));
+        REQUIRE( false == rw_lock::isWriteAvailable( context, id));
+
+        REQUIRE( true == rw_lock::unlockRead( context, id));
+        REQUIRE( true == rw_lock::unlockRead( context, id));
+        REQUIRE( false == rw_lock::unlockRead( context, id));
+
+        REQUIRE( true == rw_lock::tryLockWrite( context, id));
+        REQUIRE( false == rw_lock::tryLockWrite( context, id));
+        REQUIRE( false == rw_lock::tryLockRead( context, id));
+        REQUIRE( false == rw_lock::isReadAvailable( context, id));
+
+        REQUIRE( true == rw_lock::unlockWrite( context, id));
+        REQUIRE( false == rw_lock::unlockWrite( context, id));
+
+        REQUIRE( true == rw_lock::isReadAvailable( context, id));
+        REQUIRE( true == rw_lock::isWriteAvailable( context, id));
+    }
+
+    SECTION ( "Waiting writer holds back new readers only with PreferWriter policy.")
+    {
+        rw_lock::Id writer_first;
+        rw_lock::Id reader_first;
+
+        REQUIRE( true == rw_lock::create( context, writer_first, kernel::rw_lock::Policy::PreferWriter));
+        REQUIRE( true == rw_lock::create( context, reader_first, kernel::rw_lock::Policy::PreferReader));
+
+        for ( auto id : { writer_first, reader_first})
+        {
+            REQUIRE( true == rw_lock::tryLockRead( context, id));
+            REQUIRE( false == rw_lock::tryLockWrite( context, id));
+
+            rw_lock::addWaitingWriter( context, id);
+        }
+
+        REQUIRE( false == rw_lock::tryLockRead( context, writer_first));
+        REQUIRE( true == rw_lock::tryLockRead( context, reader_first));
+
+        // Writer takes lock after last reader left.
+        REQUIRE( true == rw_lock::unlockRead( context, writer_first));
+        REQUIRE( true == rw_lock::tryLockWrite( context, writer_first));
+
+        rw_lock::removeWaitingWriter( context, writer_first);
+        REQUIRE( true == rw_lock::unlockWrite( context, writer_first));
+
+        REQUIRE( true == rw_lock::tryLockRead( context, writer_first));
+    }
+
+    SECTION ( "Create maximum number of locks.")
+    {
+        rw_lock::Id id;
+
+        for ( size_t i = 0U; i < rw_lock::max_number; ++i)
+        {
+            REQUIRE( true == rw_lock::create( context, id, kernel::rw_lock::Policy::PreferWriter));
+            REQUIRE( static_cast< rw_lock::Id>( i) == id);
+        }
+
+        REQUIRE( false == rw_lock::create( context, id, kernel::rw_lock::Policy::PreferWriter));
+
+        // Recreated lock is free.
+        id = static_cast< rw_lock::Id>( 0U);
+        REQUIRE( true == rw_lock::tryLockWrite( context, id));
+        rw_lock::destroy( context, id);
+
+        REQUIRE( true == rw_lock::create( context, id, kernel::rw_lock::Policy::PreferReader));
+        REQUIRE( static_cast< rw_lock::Id>( 0U) == id);
+        REQUIRE( true == rw_lock::tryLockRead( context, id));
+    }
+}
@@ -24,13 +24,6 @@ namespace
 
 namespace kernel::hardware
 {
-    namespace debug
-    {
-        void setBreakpoint()
-        {
-        }
-    }
-
     namespace critical_section
     {
         void enter(
@@ -55,9 +48,7 @@ namespace
         // kernel::internal context
         scheduler::Context      m_Scheduler;
         task::Context           m_Task;
-        timer::Context          m_Timer;
-        event::Context          m_Event;
-        queue::Context          m_Queue;
+        handle::Context         m_Objects;
 
         // members used by specyfic test case instance
         std::vector< task::Id>   m_TaskHandles;
@@ -626,9 +617,7 @@ TEST_CASE("Scheduler")
                 checkWaitConditions(
                     context->m_Scheduler,
                     context->m_Task,
-                    context->m_Timer,
-                    context->m_Event,
-                    context->m_Queue,
+                    context->m_Objects,
                     new_time
                 );
             }
@@ -725,7 +714,7 @@ TEST_CASE("Scheduler")
             // Create event.
             {
                 kernel::internal::event::Id new_event_id;
-                bool result = kernel::internal::event::create( context->m_Event, new_event_id, true, nullptr);
+                bool result = kernel::internal::event::create( context->m_Objects.m_events, new_event_id, true, nullptr);
                 
                 REQUIRE( true == result);
 
@@ -774,7 +763,7 @@ TEST_CASE("Scheduler")
                 kernel::TimeMs interval = 10000U;
 
                 bool result = kernel::internal::timer::create(
-                    context->m_Timer,
+                    context->m_Objects.m_timers,
                     new_timer_id,
                     start,
                     interval
@@ -783,7 +772,7 @@ TEST_CASE("Scheduler")
                 REQUIRE( true == result);
 
                 kernel::internal::timer::start(
-                    context->m_Timer,
+                    context->m_Objects.m_timers,
                     new_timer_id);
 
                 timer = kernel::internal::handle::create(
@@ -829,9 +818,7 @@ TEST_CASE("Scheduler")
             checkWaitConditions(
                 context->m_Scheduler,
                 context->m_Task,
-                context->m_Timer,
-                context->m_Event,
-                context->m_Queue,
+                context->m_Objects,
                 currentTime
                 );
         }
@@ -849,7 +836,7 @@ TEST_CASE("Scheduler")
         // Set event.
         {
             auto id = kernel::internal::handle::getId<kernel::internal::event::Id>( event);
-            kernel::internal::event::set( context->m_Event, id);
+            kernel::internal::event::set( context->m_Objects.m_events, id);
         }
 
         // Check conditions.
@@ -859,9 +846,7 @@ TEST_CASE("Scheduler")
             checkWaitConditions(
                 context->m_Scheduler,
                 context->m_Task,
-                context->m_Timer,
-                context->m_Event,
-                context->m_Queue,
+                context->m_Objects,
                 currentTime
             );
         }
@@ -882,7 +867,7 @@ TEST_CASE("Scheduler")
             // set new value higher than expected.
             kernel::TimeMs currentTime = 10001U;
 
-            kernel::internal::timer::tick( context->m_Timer, currentTime);
+            kernel::internal::timer::tick( context->m_Objects.m_timers, currentTime);
         }
 
         // Check conditions.
@@ -892,9 +877,7 @@ TEST_CASE("Scheduler")
             checkWaitConditions(
                 context->m_Scheduler,
                 context->m_Task,
-                context->m_Timer,
-                context->m_Event,
-                context->m_Queue,
+                context->m_Objects,
                 currentTime
             );
         }
@@ -908,4 +891,213 @@ TEST_CASE("Scheduler")
             REQUIRE( kernel::task::State::Ready == task::state::get( context->m_Task, context->m_TaskHandles.at( 2U)));
         }
     }
+
+    SECTION( "Wake up waiting task directly, without checking its wait conditions.")
+    {
+        std::unique_ptr<test_case_context> context(new test_case_context);
+
+        kernel::Handle event;
+
+        // Pre-condition
+        {
+            context->allocate_tasks( kernel::task::Priority::Low, 2U);
+
+            for (uint32_t i = 0U; i < 2U; ++i)
+            {
+                bool result = scheduler::addReadyTask(
+                    context->m_Scheduler,
+                    context->m_Task,
+                    context->m_TaskHandles.at( i)
+                );
+                REQUIRE( true == result);
+            }
+        }
+
+        // Set Task 1 to wait for event, which is never set.
+        {
+            kernel::internal::event::Id new_event_id;
+            bool result = kernel::internal::event::create( context->m_Objects.m_events, new_event_id, true, nullptr);
+
+            REQUIRE( true == result);
+
+            event = kernel::internal::handle::create(
+                kernel::internal::handle::ObjectType::Event,
+                new_event_id
+            );
+
+            kernel::TimeMs unused_ref = 0U;
+            const bool wait_for_all_signals = true;
+            bool wait_forever = true;
+
+            task::Id task_to_wait = context->m_TaskHandles.at( 1U);
+
+            setTaskToWaitForObj(
+                context->m_Scheduler,
+                context->m_Task,
+                task_to_wait,
+                &event,
+                1U,
+                wait_for_all_signals,
+                wait_forever,
+                unused_ref,
+                unused_ref
+            );
+        }
+
+        // Ready task cannot be woken up.
+        {
+            task::Id ready_task = context->m_TaskHandles.at( 0U);
+
+            REQUIRE( false == wakeWaitingTask( context->m_Scheduler, context->m_Task, ready_task, kernel::sync::WaitResult::ObjectSet, 0U));
+        }
+
+        // Wake up Task 1.
+        {
+            task::Id waiting_task = context->m_TaskHandles.at( 1U);
+
+            REQUIRE( true == wakeWaitingTask( context->m_Scheduler, context->m_Task, waiting_task, kernel::sync::WaitResult::ObjectSet, 0U));
+
+            using namespace kernel::internal;
+            REQUIRE( kernel::task::State::Ready == task::state::get( context->m_Task, waiting_task));
+            REQUIRE( kernel::sync::WaitResult::ObjectSet == task::wait::result::get( context->m_Task, waiting_task));
+        }
+
+        // Task is removed from wait list, so setting event later does not change its result.
+        {
+            auto id = kernel::internal::handle::getId<kernel::internal::event::Id>( event);
+            kernel::internal::event::set( context->m_Objects.m_events, id);
+
+            kernel::TimeMs currentTime = 11U;
+
+            checkWaitConditions(
+                context->m_Scheduler,
+                context->m_Task,
+                context->m_Objects,
+                currentTime
+            );
+
+            using namespace kernel::internal;
+            REQUIRE( kernel::task::State::Ready == task::state::get( context->m_Task, context->m_TaskHandles.at( 1U)));
+            REQUIRE( true == kernel::internal::event::isSignaled( context->m_Objects.m_events, id));
+        }
+    }
+
+    SECTION( "Find the highest priority task waiting for object.")
+    {
+        std::unique_ptr<test_case_context> context(new test_case_context);
+
+        kernel::Handle events[ 2];
+
+        // Pre-condition: Task 0 and 1 are Low priority, Task 2 is High priority.
+        {
+            context->allocate_tasks( kernel::task::Priority::Low, 2U);
+            context->allocate_tasks( kernel::task::Priority::High, 1U);
+
+            for (uint32_t i = 0U; i < 3U; ++i)
+            {
+                REQUIRE( true == scheduler::addReadyTask( context->m_Scheduler, context->m_Task, context->m_TaskHandles.at( i)));
+            }
+
+            for ( auto & event : events)
+            {
+                kernel::internal::event::Id new_event_id;
+
+                REQUIRE( true == kernel::internal::event::create( context->m_Objects.m_events, new_event_id, false, nullptr));
+
+                event = kernel::internal::handle::create( kernel::internal::handle::ObjectType::Event, new_event_id);
+            }
+        }
+
+        // Task 0 and Task 2 wait for first event, Task 1 waits for second event.
+        {
+            kernel::TimeMs unused_ref = 0U;
+            bool wait_forever = true;
+
+            const uint32_t event_index[ 3] = { 0U, 1U, 0U};
+
+            for ( uint32_t i = 0U; i < 3U; ++i)
+            {
+                task::Id task_to_wait = context->m_TaskHandles.at( i);
+
+                REQUIRE( true == setTaskToWaitForObj(
+                    context->m_Scheduler,
+                    context->m_Task,
+                    task_to_wait,
+                    &events[ event_index[ i]],
+                    1U,
+                    false,
+                    wait_forever,
+                    unused_ref,
+                    unused_ref
+                ));
+            }
+        }
+
+        // High priority task is found first, regardless of wait list order.
+        {
+            task::Id waiting_task;
+
+            REQUIRE( true == findWaitingTask( context->m_Scheduler, context->m_Task, events[ 0], waiting_task));
+            REQUIRE( context->m_TaskHandles.at( 2U) == waiting_task);
+
+            REQUIRE( true == wakeWaitingTask( context->m_Scheduler, context->m_Task, waiting_task, kernel::sync::WaitResult::ObjectSet, 0U));
+
+            REQUIRE( true == findWaitingTask( context->m_Scheduler, context->m_Task, events[ 0], waiting_task));
+            REQUIRE( context->m_TaskHandles.at( 0U) == waiting_task);
+
+            REQUIRE( true == wakeWaitingTask( context->m_Scheduler, context->m_Task, waiting_task, kernel::sync::WaitResult::ObjectSet, 0U));
+
+            REQUIRE( false == findWaitingTask( context->m_Scheduler, context->m_Task, events[ 0], waiting_task));
+
+            REQUIRE( true == findWaitingTask( context->m_Scheduler, context->m_Task, events[ 1], waiting_task));
+            REQUIRE( context->m_TaskHandles.at( 1U) == waiting_task);
+        }
+    }
+
+    SECTION( "Preempt current task only by task of higher priority.")
+    {
+        std::unique_ptr<test_case_context> context(new test_case_context);
+
+        // Pre-condition: Task 0 is Low priority and it is running. Task 1 is High priority and it is waiting.
+        {
+            context->allocate_tasks( kernel::task::Priority::Low, 2U);
+            context->allocate_tasks( kernel::task::Priority::High, 1U);
+
+            for (uint32_t i = 0U; i < 2U; ++i)
+            {
+                REQUIRE( true == scheduler::addReadyTask( context->m_Scheduler, context->m_Task, context->m_TaskHandles.at( i)));
+            }
+
+            task::Id current_task;
+
+            REQUIRE( true == getCurrentTask( context->m_Scheduler, context->m_Task, current_task));
+            REQUIRE( context->m_TaskHandles.at( 0U) == current_task);
+        }
+
+        // Task of the same priority does not preempt current task.
+        {
+            task::Id next_task;
+
+            REQUIRE( false == preemptCurrentTask( context->m_Scheduler, context->m_Task, next_task));
+            REQUIRE( context->m_TaskHandles.at( 0U) == getCurrentTaskId( context->m_Scheduler));
+        }
+
+        // High priority task was made Ready (ie. by interrupt).
+        {
+            REQUIRE( true == scheduler::addReadyTask( context->m_Scheduler, context->m_Task, context->m_TaskHandles.at( 2U)));
+
+            task::Id next_task;
+
+            REQUIRE( true == preemptCurrentTask( context->m_Scheduler, context->m_Task, next_task));
+            REQUIRE( context->m_TaskHandles.at( 2U) == next_task);
+            REQUIRE( next_task == getCurrentTaskId( context->m_Scheduler));
+
+            using namespace kernel::internal;
+            REQUIRE( kernel::task::State::Running == task::state::get( context->m_Task, next_task));
+            REQUIRE( kernel::task::State::Ready == task::state::get( context->m_Task, context->m_TaskHandles.at( 0U)));
+
+            // Highest priority task is never preempted.
+            REQUIRE( false == preemptCurrentTask( context->m_Scheduler, context->m_Task, next_task));
+        }
+    }
 }
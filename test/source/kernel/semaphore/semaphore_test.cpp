@@ -0,0 +1,58 @@
+#include "catch.hpp"
+
+#include "semaphore/semaphore.hpp"
+
+TEST_CASE( "Semaphore")
+{
+    using namespace kernel::internal;
+
+    semaphore::Context context;
+
+    SECTION ( "Give and take up to maximum count.")
+    {
+        constexpr uint32_t Max_count{ 3U};
+
+        semaphore::Id id;
+
+        REQUIRE( true == semaphore::create( context, id, Max_count, 1U));
+        REQUIRE( 1U == semaphore::getCount( context, id));
+        REQUIRE( true == semaphore::isAvailable( context, id));
+
+        REQUIRE( true == semaphore::give( context, id));
+        REQUIRE( true == semaphore::give( context, id));
+
+        // Count does not exceed its maximum.
+        REQUIRE( false == semaphore::give( context, id));
+        REQUIRE( Max_count == semaphore::getCount( context, id));
+
+        for ( uint32_t i = 0U; i < Max_count; ++i)
+        {
+            REQUIRE( true == semaphore::take( context, id));
+        }
+
+        REQUIRE( false == semaphore::take( context, id));
+        REQUIRE( 0U == semaphore::getCount( context, id));
+        REQUIRE( false == semaphore::isAvailable( context, id));
+    }
+
+    SECTION ( "Create maximum number of semaphores.")
+    {
+        semaphore::Id id;
+
+        for ( size_t i = 0U; i < semaphore::max_number; ++i)
+        {
+            REQUIRE( true == semaphore::create( context, id, 1U, 0U));
+            REQUIRE( static_cast< semaphore::Id>( i) == id);
+        }
+
+        REQUIRE( false == semaphore::create( context, id, 1U, 0U));
+
+        // Recreated semaphore gets new count.
+        id = static_cast< semaphore::Id>( 0U);
+        semaphore::destroy( context, id);
+
+        REQUIRE( true == semaphore::create( context, id, 2U, 2U));
+        REQUIRE( static_cast< semaphore::Id>( 0U) == id);
+        REQUIRE( 2U == semaphore::getCount( context, id));
+    }
+}
@@ -0,0 +1,146 @@
+#include "catch.hpp"
+
+#include "stream_buffer/stream_buffer.hpp"
+
+#include <cstring>
+
+TEST_CASE( "StreamBuffer")
+{
+    using namespace kernel::internal;
+
+    SECTION ( "Stream bytes around buffer end.")
+    {
+        constexpr size_t Max_buffer_size{ 8U};
+        kernel::stream_buffer::Buffer< Max_buffer_size> buffer;
+
+        stream_buffer::Context context;
+        stream_buffer::Id id;
+
+        REQUIRE( true == stream_buffer::create( context, id, Max_buffer_size, &buffer.m_data, 1U, false));
+        REQUIRE( 0U == stream_buffer::getSize( context, id));
+
+        // Only bytes that fit are sent.
+        const char first_part[] = "0123456789";
+
+        REQUIRE( Max_buffer_size == stream_buffer::send( context, id, first_part, 10U));
+        REQUIRE( 0U == stream_buffer::send( context, id, first_part, 1U));
+
+        char received_data[ 16]{};
+
+        REQUIRE( 5U == stream_buffer::receive( context, id, received_data, 5U));
+        REQUIRE( 0 == std::memcmp( received_data, "01234", 5U));
+
+        // Next write is split by buffer end.
+        REQUIRE( 4U == stream_buffer::send( context, id, "abcd", 4U));
+        REQUIRE( 7U == stream_buffer::getSize( context, id));
+
+        REQUIRE( 7U == stream_buffer::receive( context, id, received_data, sizeof( received_data)));
+        REQUIRE( 0 == std::memcmp( received_data, "567abcd", 7U));
+
+        REQUIRE( 0U == stream_buffer::receive( context, id, received_data, sizeof( received_data)));
+
+        // Stream functions do not work with message buffer.
+        REQUIRE( false == stream_buffer::sendMessage( context, id, "x", 1U));
+
+        stream_buffer::destroy( context, id);
+    }
+
+    SECTION ( "Stream buffer is triggered at trigger level or when full.")
+    {
+        constexpr size_t Max_buffer_size{ 8U};
+        kernel::stream_buffer::Buffer< Max_buffer_size> buffer;
+
+        stream_buffer::Context context;
+        stream_buffer::Id id;
+
+        REQUIRE( true == stream_buffer::create( context, id, Max_buffer_size, &buffer.m_data, 4U, false));
+        REQUIRE( false == stream_buffer::isTriggered( context, id));
+
+        REQUIRE( 3U == stream_buffer::send( context, id, "abc", 3U));
+        REQUIRE( false == stream_buffer::isTriggered( context, id));
+
+        REQUIRE( 1U == stream_buffer::send( context, id, "d", 1U));
+        REQUIRE( true == stream_buffer::isTriggered( context, id));
+
+        // Trigger level above buffer size is reached only by full buffer.
+        stream_buffer::setTriggerLevel( context, id, 100U);
+        REQUIRE( false == stream_buffer::isTriggered( context, id));
+
+        REQUIRE( false == stream_buffer::isFull( context, id));
+        REQUIRE( 4U == stream_buffer::send( context, id, "efgh", 4U));
+        REQUIRE( true == stream_buffer::isTriggered( context, id));
+        REQUIRE( true == stream_buffer::isFull( context, id));
+
+        // Single free byte is enough for blocked writer.
+        char received_data[ 1U]{};
+
+        REQUIRE( 1U == stream_buffer::receive( context, id, received_data, sizeof( received_data)));
+        REQUIRE( false == stream_buffer::isFull( context, id));
+    }
+
+    SECTION ( "Variable size messages are received whole.")
+    {
+        constexpr size_t Max_buffer_size{ 16U};
+        kernel::message_buffer::Buffer< Max_buffer_size> buffer;
+
+        stream_buffer::Context context;
+        stream_buffer::Id id;
+
+        REQUIRE( true == stream_buffer::create( context, id, Max_buffer_size, &buffer.m_data, 1U, true));
+        REQUIRE( false == stream_buffer::isTriggered( context, id));
+        REQUIRE( 0U == stream_buffer::getNextMessageLength( context, id));
+
+        // Each message takes its length plus 2 bytes of prefix.
+        REQUIRE( true == stream_buffer::sendMessage( context, id, "hello", 5U));
+        REQUIRE( true == stream_buffer::sendMessage( context, id, "abcdef", 6U));
+        REQUIRE( true == stream_buffer::isTriggered( context, id));
+        REQUIRE( 11U == stream_buffer::getSize( context, id));
+
+        // Message is not split when it does not fit.
+        REQUIRE( false == stream_buffer::sendMessage( context, id, "x", 1U));
+
+        // Byte stream functions do not work with message buffer.
+        char received_data[ 16]{};
+        REQUIRE( 0U == stream_buffer::send( context, id, "x", 1U));
+        REQUIRE( 0U == stream_buffer::receive( context, id, received_data, 1U));
+
+        // Message longer than destination is left in buffer.
+        REQUIRE( 5U == stream_buffer::getNextMessageLength( context, id));
+        REQUIRE( 0U == stream_buffer::receiveMessage( context, id, received_data, 4U));
+
+        REQUIRE( 5U == stream_buffer::receiveMessage( context, id, received_data, sizeof( received_data)));
+        REQUIRE( 0 == std::memcmp( received_data, "hello", 5U));
+
+        // Prefix of the next message is split by buffer end.
+        REQUIRE( true == stream_buffer::sendMessage( context, id, "xyz", 3U));
+
+        REQUIRE( 6U == stream_buffer::receiveMessage( context, id, received_data, sizeof( received_data)));
+        REQUIRE( 0 == std::memcmp( received_data, "abcdef", 6U));
+
+        REQUIRE( 3U == stream_buffer::getNextMessageLength( context, id));
+        REQUIRE( 3U == stream_buffer::receiveMessage( context, id, received_data, sizeof( received_data)));
+        REQUIRE( 0 == std::memcmp( received_data, "xyz", 3U));
+
+        REQUIRE( 0U == stream_buffer::getSize( context, id));
+        REQUIRE( false == stream_buffer::isTriggered( context, id));
+        REQUIRE( 0U == stream_buffer::receiveMessage( context, id, received_data, sizeof( received_data)));
+    }
+
+    SECTION ( "Message buffer trigger level does not count length prefixes.")
+    {
+        constexpr size_t Max_buffer_size{ 32U};
+        kernel::message_buffer::Buffer< Max_buffer_size> buffer;
+
+        stream_buffer::Context context;
+        stream_buffer::Id id;
+
+        REQUIRE( true == stream_buffer::create( context, id, Max_buffer_size, &buffer.m_data, 6U, true));
+
+        REQUIRE( true == stream_buffer::sendMessage( context, id, "abc", 3U));
+        REQUIRE( true == stream_buffer::sendMessage( context, id, "de", 2U));
+        REQUIRE( false == stream_buffer::isTriggered( context, id));
+
+        REQUIRE( true == stream_buffer::sendMessage( context, id, "f", 1U));
+        REQUIRE( true == stream_buffer::isTriggered( context, id));
+    }
+}
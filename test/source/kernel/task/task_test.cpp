@@ -13,18 +13,6 @@ namespace
     }
 }
 
-namespace kernel::internal::hardware::task
-{
-    void Stack::init( uint32_t a_routine_address) volatile
-    {
-    }
-
-    uint32_t Stack::getStackPointer() volatile
-    {
-        return 0U;
-    }
-}
-
 TEST_CASE( "Task")
 {
     SECTION ( "Create new task and verify context data.")
@@ -157,4 +145,62 @@ TEST_CASE( "Task")
             // verify if state has changed
             REQUIRE( kernel::task::State::Running == task::state::get( context, task_id));
     }
+
+    SECTION ( "Notify task and take its notification value.")
+    {
+        using namespace kernel::internal;
+
+        std::unique_ptr< task::Context> m_heap_context( new task::Context);
+        task::Context & context = *m_heap_context;
+        task::Id task_id{};
+        uint32_t value = 0xFFU;
+
+        REQUIRE( true == task::create( context, kernel_task_routine, task_routine, kernel::task::Priority::Medium, &task_id, nullptr, false));
+
+        // New task has no notification.
+        REQUIRE( false == task::notification::take( context, task_id, true, value));
+        REQUIRE( 0U == value);
+
+        REQUIRE( 0x0U == task::notification::notify( context, task_id, 0x5U, kernel::task::NotifyAction::SetBits));
+        REQUIRE( 0x5U == task::notification::notify( context, task_id, 0x8U, kernel::task::NotifyAction::SetBits));
+
+        // Clear on exit.
+        REQUIRE( true == task::notification::take( context, task_id, true, value));
+        REQUIRE( 0xDU == value);
+        REQUIRE( false == task::notification::take( context, task_id, true, value));
+
+        // Increment ignores value, so notifications are counted.
+        task::notification::notify( context, task_id, 0x100U, kernel::task::NotifyAction::Increment);
+        task::notification::notify( context, task_id, 0x100U, kernel::task::NotifyAction::Increment);
+
+        // Decrement on exit.
+        REQUIRE( true == task::notification::take( context, task_id, false, value));
+        REQUIRE( 2U == value);
+        REQUIRE( true == task::notification::take( context, task_id, false, value));
+        REQUIRE( 1U == value);
+        REQUIRE( false == task::notification::take( context, task_id, false, value));
+
+        REQUIRE( 0U == task::notification::notify( context, task_id, 0x7U, kernel::task::NotifyAction::Overwrite));
+        REQUIRE( 0x7U == task::notification::notify( context, task_id, 0x2U, kernel::task::NotifyAction::Overwrite));
+
+        // Notification is pending only for waiting task.
+        REQUIRE( false == task::notification::isPending( context, task_id));
+
+        task::notification::setWaiting( context, task_id, true);
+
+        REQUIRE( true == task::notification::isWaiting( context, task_id));
+        REQUIRE( true == task::notification::isPending( context, task_id));
+
+        REQUIRE( true == task::notification::take( context, task_id, true, value));
+        REQUIRE( 0x2U == value);
+        REQUIRE( false == task::notification::isPending( context, task_id));
+
+        // Recreated task starts without notification.
+        task::notification::notify( context, task_id, 0x1U, kernel::task::NotifyAction::SetBits);
+        task::destroy( context, task_id);
+
+        REQUIRE( true == task::create( context, kernel_task_routine, task_routine, kernel::task::Priority::Medium, &task_id, nullptr, false));
+        REQUIRE( false == task::notification::isWaiting( context, task_id));
+        REQUIRE( false == task::notification::take( context, task_id, true, value));
+    }
 }
\ No newline at end of file
@@ -0,0 +1,168 @@
+#include "catch.hpp"
+
+#include "timer/timer.hpp"
+
+namespace
+{
+    void countCallback( void * a_parameter)
+    {
+        ++( *reinterpret_cast< uint32_t *>( a_parameter));
+    }
+
+    // Call all pending callbacks, like timer service task does.
+    void callPendingCallbacks( kernel::internal::timer::Context & a_context)
+    {
+        kernel::timer::Callback callback;
+        void * parameter;
+
+        while ( true == kernel::internal::timer::takeCallback( a_context, callback, parameter))
+        {
+            callback( parameter);
+        }
+    }
+}
+
+TEST_CASE( "Timer")
+{
+    using namespace kernel::internal;
+
+    timer::Context context;
+
+    kernel::TimeMs start = 0U;
+    kernel::TimeMs interval = 10U;
+    uint32_t calls = 0U;
+
+    SECTION ( "Timer without callback finishes and has no callback pending.")
+    {
+        timer::Id id;
+
+        REQUIRE( true == timer::create( context, id, start, interval));
+        timer::start( context, id);
+
+        for ( kernel::TimeMs time = 1U; time <= 20U; ++time)
+        {
+            REQUIRE( false == timer::tick( context, time));
+        }
+
+        REQUIRE( timer::State::Finished == timer::getState( context, id));
+    }
+
+    SECTION ( "One-shot timer calls its callback once.")
+    {
+        timer::Id id;
+
+        REQUIRE( true == timer::create( context, id, start, interval, countCallback, &calls));
+        timer::start( context, id);
+
+        kernel::TimeMs time = 10U;
+        REQUIRE( false == timer::tick( context, time));
+
+        time = 11U;
+        REQUIRE( true == timer::tick( context, time));
+        REQUIRE( timer::State::Finished == timer::getState( context, id));
+
+        callPendingCallbacks( context);
+        REQUIRE( 1U == calls);
+
+        for ( time = 12U; time <= 50U; ++time)
+        {
+            REQUIRE( false == timer::tick( context, time));
+        }
+
+        callPendingCallbacks( context);
+        REQUIRE( 1U == calls);
+    }
+
+    SECTION ( "Auto-reload timer keeps its period without drift.")
+    {
+        timer::Id id;
+
+        REQUIRE( true == timer::create( context, id, start, interval, countCallback, &calls, true));
+        timer::start( context, id);
+
+        for ( kernel::TimeMs time = 1U; time <= 101U; ++time)
+        {
+            ( void) timer::tick( context, time);
+            callPendingCallbacks( context);
+        }
+
+        // Expirations at 11, 21, ..., 101 ms.
+        REQUIRE( 10U == calls);
+        REQUIRE( timer::State::Started == timer::getState( context, id));
+    }
+
+    SECTION ( "Callbacks, which service task was late for, are all called.")
+    {
+        timer::Id id;
+
+        REQUIRE( true == timer::create( context, id, start, interval, countCallback, &calls, true));
+        timer::start( context, id);
+
+        for ( kernel::TimeMs time = 1U; time <= 31U; ++time)
+        {
+            ( void) timer::tick( context, time);
+        }
+
+        callPendingCallbacks( context);
+        REQUIRE( 3U == calls);
+    }
+
+    SECTION ( "Pending callbacks of timers are called in turns.")
+    {
+        timer::Id first_id;
+        timer::Id second_id;
+
+        kernel::TimeMs long_interval = 30U;
+        uint32_t second_calls = 0U;
+
+        REQUIRE( true == timer::create( context, first_id, start, interval, countCallback, &calls, true));
+        REQUIRE( true == timer::create( context, second_id, start, long_interval, countCallback, &second_calls));
+        timer::start( context, first_id);
+        timer::start( context, second_id);
+
+        for ( kernel::TimeMs time = 1U; time <= 31U; ++time)
+        {
+            ( void) timer::tick( context, time);
+        }
+
+        kernel::timer::Callback callback;
+        void * parameter;
+
+        // First timer has 3 pending callbacks, but second timer is serviced right after
+        // the first callback.
+        REQUIRE( true == timer::takeCallback( context, callback, parameter));
+        REQUIRE( &calls == parameter);
+
+        REQUIRE( true == timer::takeCallback( context, callback, parameter));
+        REQUIRE( &second_calls == parameter);
+
+        REQUIRE( true == timer::takeCallback( context, callback, parameter));
+        REQUIRE( &calls == parameter);
+
+        REQUIRE( true == timer::takeCallback( context, callback, parameter));
+        REQUIRE( &calls == parameter);
+
+        REQUIRE( false == timer::takeCallback( context, callback, parameter));
+    }
+
+    SECTION ( "Stop discards pending callbacks.")
+    {
+        timer::Id id;
+
+        REQUIRE( true == timer::create( context, id, start, interval, countCallback, &calls, true));
+        timer::start( context, id);
+
+        for ( kernel::TimeMs time = 1U; time <= 31U; ++time)
+        {
+            ( void) timer::tick( context, time);
+        }
+
+        timer::stop( context, id);
+
+        kernel::TimeMs time = 32U;
+        REQUIRE( false == timer::tick( context, time));
+
+        callPendingCallbacks( context);
+        REQUIRE( 0U == calls);
+    }
+}
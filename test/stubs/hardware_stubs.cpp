@@ -1,4 +1,15 @@
 #include <kernel.hpp>
+#include <hardware/hardware.hpp>
+
+#include "hardware_stubs.hpp"
+
+#include <atomic>
+
+namespace kernel::internal::hardware::stubs
+{
+    bool is_handler_mode{ false};
+    bool is_reschedule_pended{ false};
+}
 
 // Stubs for hardware interface.
 namespace kernel::hardware::critical_section
@@ -13,3 +24,115 @@ namespace kernel::hardware::critical_section
     {
     }
 }
+
+namespace kernel::internal::hardware::utility
+{
+    // Host equivalent of DMB.
+    void memoryBarrier()
+    {
+        std::atomic_thread_fence( std::memory_order_seq_cst);
+    }
+
+    // Host equivalent of LDREX/STREX pair.
+    bool compareAndSwap( volatile uint32_t & a_value, uint32_t a_expected, uint32_t a_desired)
+    {
+        static_assert( sizeof( std::atomic< uint32_t>) == sizeof( uint32_t));
+
+        auto & atomic_value = reinterpret_cast< volatile std::atomic< uint32_t> &>( a_value);
+
+        return atomic_value.compare_exchange_weak( a_expected, a_desired, std::memory_order_seq_cst);
+    }
+
+    bool isHandlerMode()
+    {
+        return stubs::is_handler_mode;
+    }
+}
+
+namespace kernel::hardware::interrupt
+{
+    void wait()
+    {
+    }
+}
+
+namespace kernel::hardware::debug
+{
+    void print( const char * s)
+    {
+    }
+
+    void setBreakpoint()
+    {
+    }
+}
+
+namespace kernel::internal::hardware::task
+{
+    // Tasks are never run in tests, so stack holds no initial frame.
+    void Stack::init( uint32_t a_routine_address) volatile
+    {
+    }
+
+    uint32_t Stack::getStackPointer() volatile
+    {
+        return 0U;
+    }
+}
+
+namespace kernel::internal::hardware
+{
+    // Exceptions run at once, like SVC does, but no task context is switched.
+    void syscall( SyscallId a_id)
+    {
+        switch( a_id)
+        {
+        case SyscallId::LoadNextTask:
+            kernel::internal::loadNextTask();
+            break;
+        case SyscallId::ExecuteContextSwitch:
+            kernel::internal::switchContext();
+            break;
+        }
+    }
+
+    // Tests drive kernel::internal::tick( false) themselves, so reschedule is only recorded.
+    void pendReschedule()
+    {
+        stubs::is_reschedule_pended = true;
+    }
+
+    void init()
+    {
+    }
+
+    void start()
+    {
+    }
+
+    namespace sp
+    {
+        uint32_t get()
+        {
+            return 0U;
+        }
+
+        void set( uint32_t)
+        {
+        }
+    }
+
+    namespace context::current
+    {
+        void set( volatile task::Context * a_context)
+        {
+        }
+    }
+
+    namespace context::next
+    {
+        void set( volatile task::Context * a_context)
+        {
+        }
+    }
+}
@@ -0,0 +1,11 @@
+#pragma once
+
+// Control of hardware stubs used by tests.
+namespace kernel::internal::hardware::stubs
+{
+    // Tests run in thread mode, unless they simulate interrupt routine.
+    extern bool is_handler_mode;
+
+    // Set by pendReschedule. Tests reset it themselves.
+    extern bool is_reschedule_pended;
+}